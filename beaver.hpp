@@ -10,6 +10,8 @@
 #include "beaver/svdilog.hpp"
 #include "beaver/atanint.hpp"
 #include "beaver/trilog.hpp"
+#include "beaver/clausen.hpp"
+#include "beaver/approximant.hpp"
 //#include "BEAVER/g.hpp"
 //#include "BEAVER/h.hpp"
 
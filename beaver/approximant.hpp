@@ -0,0 +1,294 @@
+#ifndef BEAVER_APPROXIMANT_HPP
+#define BEAVER_APPROXIMANT_HPP
+#include "config.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace beaver {
+  // ----------- runtime approximants of user-defined functions -----------
+  // Piecewise Chebyshev interpolants on adaptively bisected subintervals of [a,b]:
+  // every piece maps x onto t in [-1,1] and, like the library kernels, is evaluated as a
+  // polynomial in Estrin scheme (the Chebyshev series is converted to monomials in t).
+  // Binary layout (native byte order, all fields 8-byte aligned so that a memory-mapped
+  // blob is evaluated in place):
+  //   header: magic "BVRAPPX1", uint32 version, uint32 ncoef, uint64 npieces, double a, b, max_error
+  //   double breaks[npieces+1]
+  //   double pieces[npieces][ncoef+2]   (mid, 2/width, a_0..a_{ncoef-1} of the polynomial in t)
+  namespace internals::approximant{
+  const double pi=3.1415926535897932385;
+  const char magic[8]={'B','V','R','A','P','P','X','1'};
+  const std::uint32_t version=1;
+  struct header{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t ncoef;
+    std::uint64_t npieces;
+    double a;
+    double b;
+    double max_error;
+  };
+  static_assert(sizeof(header)==48, "approximant header must be packed to 48 bytes");
+
+    //largest supported number of coefficients per piece (bounds the Estrin scratch space)
+  const int max_ncoef=64;
+    //Chebyshev series c_0+c_1 T_1(t)+...+c_{n-1}T_{n-1}(t) to monomial coefficients a_0+a_1 t+...
+  inline void chebyshev_to_monomial(const double* c, int n, double* a) noexcept{
+    double tkm1[max_ncoef]={1.0};//T_{k-1}
+    double tk[max_ncoef]={0.0,1.0};//T_k
+    for(int j=0;j<n;++j) a[j]=0.0;
+    a[0]=c[0];
+    if(n>1) a[1]=c[1];
+    for(int k=2;k<n;++k){
+      //T_k=2t T_{k-1}-T_{k-2}. Its integer coefficients pass 2^53 from k=45 (up to ~2^77 at k=63), but
+      //their odd parts stay below 2^41, so the recurrence is exact for k<max_ncoef. The sums a_j+=c_k T_k[j]
+      //are not: they round and cancel at high degree, which is why build() verifies the converted polynomial.
+      double next[max_ncoef];
+      next[0]=-tkm1[0];
+      for(int j=1;j<=k;++j) next[j]=2.0*tk[j-1]-((j<k-1) ? tkm1[j] : 0.0);
+      for(int j=0;j<=k;++j){
+        a[j]+=c[k]*next[j];
+        tkm1[j]=tk[j];
+        tk[j]=next[j];
+      }
+    }
+  }
+    //polynomial a_0+a_1 t+...+a_{n-1}t^{n-1} in Estrin scheme (pairwise, log2(n) deep)
+  inline double estrin(const double* a, int n, double t) noexcept{
+    double p[max_ncoef/2+1];
+    int m=0;
+    for(int j=0;j+1<n;j+=2) p[m++]=a[j]+a[j+1]*t;
+    if(n&1) p[m++]=a[n-1];
+    double s=t*t;
+    while(m>1){
+      int k=0;
+      for(int j=0;j+1<m;j+=2) p[k++]=p[j]+p[j+1]*s;
+      if(m&1) p[k++]=p[m-1];
+      m=k;
+      s*=s;
+    }
+    return p[0];
+  }
+    //evaluate on the piece containing x (NaN outside [breaks[0],breaks[npieces]])
+  inline double eval(const double* breaks, const double* pieces, std::size_t npieces, int ncoef, double x) noexcept{
+    if(!(x>=breaks[0] && x<=breaks[npieces])) return std::numeric_limits<double>::quiet_NaN();
+    const std::size_t i=static_cast<std::size_t>(std::upper_bound(breaks+1,breaks+npieces,x)-(breaks+1));
+    const double* p=pieces+i*static_cast<std::size_t>(ncoef+2);
+    const double t=(x-p[0])*p[1];
+    return estrin(p+2,ncoef,t);
+  }
+  }
+
+  // ----------- non-owning evaluator, e.g. over a memory-mapped blob -----------
+  class approximant_view {
+  public:
+    approximant_view() = default;
+    approximant_view(const double* breaks, const double* pieces, std::size_t npieces, int ncoef, double max_error) noexcept
+      : breaks_(breaks), pieces_(pieces), npieces_(npieces), ncoef_(ncoef), max_error_(max_error) {}
+
+    //Parse a blob written by approximant::serialize(); the blob must outlive the view.
+    //Throws std::invalid_argument on a malformed, truncated or misaligned blob. The header fields are
+    //untrusted: the sizes are compared by division, so no product of them can wrap around.
+    static approximant_view from_blob(const void* data, std::size_t size) {
+      namespace LOC=internals::approximant;
+      LOC::header h;
+      if(data==nullptr || size<sizeof(h)) throw std::invalid_argument("beaver::approximant_view: blob too small");
+      std::memcpy(&h,data,sizeof(h));
+      if(std::memcmp(h.magic,LOC::magic,sizeof(h.magic))!=0 || h.version!=LOC::version || h.ncoef<1 || h.ncoef>static_cast<std::uint32_t>(LOC::max_ncoef) || h.npieces<1){
+        throw std::invalid_argument("beaver::approximant_view: not an approximant blob");
+      }
+      //npieces+1 breakpoints and npieces*(ncoef+2) piece doubles: 1+npieces*(ncoef+3) doubles in total
+      const std::uint64_t ndouble=(size-sizeof(h))/sizeof(double);
+      if(ndouble<1 || h.npieces>(ndouble-1)/(std::uint64_t{h.ncoef}+3)) throw std::invalid_argument("beaver::approximant_view: blob truncated");
+      const unsigned char* body=static_cast<const unsigned char*>(data)+sizeof(h);
+      if(reinterpret_cast<std::uintptr_t>(body)%alignof(double)!=0) throw std::invalid_argument("beaver::approximant_view: blob misaligned");
+      const double* breaks=reinterpret_cast<const double*>(body);
+      const std::size_t npieces=static_cast<std::size_t>(h.npieces);
+      //eval() bisects the breakpoints, they have to increase from a to b
+      if(!(breaks[0]==h.a && breaks[npieces]==h.b)) throw std::invalid_argument("beaver::approximant_view: corrupt breakpoints");
+      for(std::size_t i=0;i<npieces;++i){
+        if(!(breaks[i]<breaks[i+1])) throw std::invalid_argument("beaver::approximant_view: corrupt breakpoints");
+      }
+      return approximant_view(breaks,breaks+npieces+1,npieces,static_cast<int>(h.ncoef),h.max_error);
+    }
+
+    BEAVER_NODISCARD double operator()(double x) const noexcept {
+      return internals::approximant::eval(breaks_,pieces_,npieces_,ncoef_,x);
+    }
+    void operator()(const double* x, double* out, std::size_t n) const noexcept {
+      for(std::size_t i=0;i<n;++i){
+        out[i]=internals::approximant::eval(breaks_,pieces_,npieces_,ncoef_,x[i]);
+      }
+    }
+
+    BEAVER_NODISCARD double lower() const noexcept { return breaks_[0]; }
+    BEAVER_NODISCARD double upper() const noexcept { return breaks_[npieces_]; }
+    BEAVER_NODISCARD std::size_t pieces() const noexcept { return npieces_; }
+    BEAVER_NODISCARD int degree() const noexcept { return ncoef_-1; }
+    //largest deviation from f found on the verification grid
+    BEAVER_NODISCARD double max_error() const noexcept { return max_error_; }
+
+  private:
+    const double* breaks_=nullptr;
+    const double* pieces_=nullptr;
+    std::size_t npieces_=0;
+    int ncoef_=0;
+    double max_error_=0;
+  };
+
+  // ----------- owning approximant and its builder -----------
+  struct approximant_options {
+    int degree=16;                  //polynomial degree per piece (< 64)
+    double atol=0.0;                //absolute error floor, needed if f has zeros in [a,b]
+    std::size_t max_pieces=1u<<14;  //give up beyond this many pieces
+    int check_factor=4;             //verification points per piece = check_factor*(degree+1)
+  };
+  class approximant {
+  public:
+    using options=approximant_options;
+
+    /**
+     * @brief fit f on [a,b] so that |approx(x)-f(x)|<=max(rtol*|f(x)|,atol) on a dense verification grid
+     * @param f: callable double->double, evaluated (degree+1)*(1+check_factor) times per piece
+     * @return piecewise Chebyshev approximant; throws std::invalid_argument on bad input and
+     *         std::runtime_error if f is not finite or the tolerance needs more than max_pieces pieces
+     */
+    template<class F>
+    static approximant build(F&& f, double a, double b, double rtol, const options& opt = options{}) {
+      namespace LOC=internals::approximant;
+      if(!std::isfinite(a) || !std::isfinite(b) || !(a<b)) throw std::invalid_argument("beaver::approximant: need finite a<b");
+      if(!(rtol>=0) || !(opt.atol>=0) || (rtol==0 && opt.atol==0)) throw std::invalid_argument("beaver::approximant: need a positive tolerance");
+      if(opt.degree<0 || opt.degree>=LOC::max_ncoef || opt.check_factor<1 || opt.max_pieces<1) throw std::invalid_argument("beaver::approximant: invalid options");
+      const int n=opt.degree+1;
+      const int m=opt.check_factor*n;
+
+      approximant r;
+      r.ncoef_=n;
+      r.breaks_.push_back(a);
+      std::vector<double> fx(static_cast<std::size_t>(n));
+      std::vector<double> c(static_cast<std::size_t>(n));
+      std::vector<double> mono(static_cast<std::size_t>(n));
+      //depth-first bisection, left half first, so that the pieces come out sorted
+      std::vector<std::pair<double,double>> todo{{a,b}};
+      while(!todo.empty()){
+        const auto [lo,hi]=todo.back();
+        todo.pop_back();
+        const double mid=0.5*(lo+hi);
+        const double half=0.5*(hi-lo);
+        //interpolate at the Chebyshev points of the first kind, coefficients by a direct DCT
+        for(int j=0;j<n;++j){
+          fx[static_cast<std::size_t>(j)]=f(mid+half*std::cos(LOC::pi*(j+0.5)/n));
+          if(!std::isfinite(fx[static_cast<std::size_t>(j)])) throw std::runtime_error("beaver::approximant: f is not finite on [a,b]");
+        }
+        for(int k=0;k<n;++k){
+          double s=0;
+          for(int j=0;j<n;++j){
+            //cos(pi k(j+1/2)/n) with k(2j+1) reduced mod 4n in integers: the unreduced argument would be
+            //rounded at ulp(pi k) and put noise of that size into the high coefficients
+            s+=fx[static_cast<std::size_t>(j)]*std::cos(LOC::pi*((k*(2*j+1))%(4*n))/(2*n));
+          }
+          c[static_cast<std::size_t>(k)]=((k==0) ? 1.0 : 2.0)*s/n;
+        }
+        //coefficients below eps*sum|c_k| are round-off of the DCT; the monomial conversion would amplify
+        //such noise in c_k by up to (1+sqrt 2)^k, which no bisection removes, so they are dropped
+        double csum=0;
+        for(const double ck : c) csum+=std::fabs(ck);
+        const double cut=2.0*std::numeric_limits<double>::epsilon()*csum;
+        for(double& ck : c){
+          if(std::fabs(ck)<=cut) ck=0.0;
+        }
+        LOC::chebyshev_to_monomial(c.data(),n,mono.data());
+        //verify the final polynomial on a uniform grid including both end points, mapped exactly as in eval()
+        const double scale=1.0/half;
+        double err=0;
+        bool ok=true;
+        for(int i=0;i<=m && ok;++i){
+          const double x=(i==m) ? hi : lo+(hi-lo)*i/m;
+          const double y=f(x);
+          if(!std::isfinite(y)) throw std::runtime_error("beaver::approximant: f is not finite on [a,b]");
+          const double e=std::fabs(LOC::estrin(mono.data(),n,(x-mid)*scale)-y);
+          ok=(e<=std::max(rtol*std::fabs(y),opt.atol));
+          err=std::max(err,e);
+        }
+        if(ok){
+          r.breaks_.push_back(hi);
+          r.pieces_.push_back(mid);
+          r.pieces_.push_back(scale);
+          r.pieces_.insert(r.pieces_.end(),mono.begin(),mono.end());
+          r.max_error_=std::max(r.max_error_,err);
+          continue;
+        }
+        if(r.breaks_.size()+todo.size()+1>opt.max_pieces || !(lo<mid && mid<hi)){
+          throw std::runtime_error("beaver::approximant: tolerance not reached within max_pieces");
+        }
+        todo.emplace_back(mid,hi);
+        todo.emplace_back(lo,mid);
+      }
+      return r;
+    }
+
+    //Copy a serialized approximant (see approximant_view::from_blob for the checks)
+    static approximant deserialize(const void* data, std::size_t size) {
+      const approximant_view v=approximant_view::from_blob(data,size);
+      approximant r;
+      r.ncoef_=v.degree()+1;
+      r.max_error_=v.max_error();
+      const double* body=reinterpret_cast<const double*>(static_cast<const unsigned char*>(data)+sizeof(internals::approximant::header));
+      r.breaks_.assign(body,body+v.pieces()+1);
+      r.pieces_.assign(body+v.pieces()+1,body+v.pieces()+1+v.pieces()*static_cast<std::size_t>(r.ncoef_+2));
+      return r;
+    }
+
+    //Compact binary blob: header followed by the breakpoints and piece coefficients
+    BEAVER_NODISCARD std::vector<unsigned char> serialize() const {
+      namespace LOC=internals::approximant;
+      LOC::header h;
+      std::memcpy(h.magic,LOC::magic,sizeof(h.magic));
+      h.version=LOC::version;
+      h.ncoef=static_cast<std::uint32_t>(ncoef_);
+      h.npieces=pieces();
+      h.a=lower();
+      h.b=upper();
+      h.max_error=max_error_;
+      std::vector<unsigned char> blob(sizeof(h)+(breaks_.size()+pieces_.size())*sizeof(double));
+      unsigned char* p=blob.data();
+      std::memcpy(p,&h,sizeof(h));
+      p+=sizeof(h);
+      std::memcpy(p,breaks_.data(),breaks_.size()*sizeof(double));
+      p+=breaks_.size()*sizeof(double);
+      std::memcpy(p,pieces_.data(),pieces_.size()*sizeof(double));
+      return blob;
+    }
+
+    BEAVER_NODISCARD approximant_view view() const noexcept {
+      return approximant_view(breaks_.data(),pieces_.data(),pieces(),ncoef_,max_error_);
+    }
+    BEAVER_NODISCARD double operator()(double x) const noexcept {
+      return internals::approximant::eval(breaks_.data(),pieces_.data(),pieces(),ncoef_,x);
+    }
+    void operator()(const double* x, double* out, std::size_t n) const noexcept {
+      view()(x,out,n);
+    }
+
+    BEAVER_NODISCARD double lower() const noexcept { return breaks_.front(); }
+    BEAVER_NODISCARD double upper() const noexcept { return breaks_.back(); }
+    BEAVER_NODISCARD std::size_t pieces() const noexcept { return breaks_.size()-1; }
+    BEAVER_NODISCARD int degree() const noexcept { return ncoef_-1; }
+    //largest deviation from f found on the verification grid
+    BEAVER_NODISCARD double max_error() const noexcept { return max_error_; }
+
+  private:
+    approximant() = default;
+    std::vector<double> breaks_;
+    std::vector<double> pieces_;
+    int ncoef_=0;
+    double max_error_=0;
+  };
+}
+#endif
@@ -3,6 +3,8 @@
 //#include "log.hpp"
 #include "config.hpp"
 #include <cmath>
+#include <cstddef>
+#include <limits>
 
 
 namespace beaver {
@@ -17,51 +19,63 @@ namespace beaver {
   }
   static double arctan_Taylor(double x){
         double x2=x*x;
-        return x-1.0/3*x2*x;
+        return x+x2*x*(-1.0/3+1.0/5*x2);
     }
   
 
-  BEAVER_NODISCARD inline double  arctan(double x) noexcept {
-    namespace  LOC=internals::arctan;
-    double taylorswitch=1e-3;//switch up to which an expansion about x=0 or x=1 is used. Guarantees precission for small y.
-    double invtaylorswitch=1/taylorswitch;
-    //Catch non-finite input
-    if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
-    if(x==0){
-      return 0.0;
-    }
-      // Branchless magnitude and sign
-    double   sign = std::copysign(1.0,x);
-    double   y=std::fabs(x);
-    //
+  namespace internals::arctan{
+    //arctan for finite y>=0, correctly rounded at y=1
+  inline double kernel(double y) noexcept {
+    const double taylorswitch=1e-3;//switch up to which an expansion about x=0 or x=1 is used. Guarantees precission for small y.
+    const double invtaylorswitch=1/taylorswitch;
     if(y<taylorswitch){
-      return sign*arctan_Taylor(y);
+      return arctan_Taylor(y);
     }else if(y<1){
       double y2=y*y;
       double y4=y2*y2;
       double y6=y4*y2;
       double y8=y4*y4;
-      double p=y*LOC::P1[0]+y2*(LOC::P1[1]+y*LOC::P1[2])+y4*(LOC::P1[3]+y*LOC::P1[4])+y6*(LOC::P1[5]+y*LOC::P1[6])+y8*(LOC::P1[7]+y*LOC::P1[8]);
-      double q=LOC::Q1[0]+y*LOC::Q1[1]+y2*(LOC::Q1[2]+y*LOC::Q1[3])+y4*(LOC::Q1[4]+y*LOC::Q1[5])+y6*(LOC::Q1[6]+y*LOC::Q1[7])+y8*(LOC::Q1[8]+y*LOC::Q1[9]);
-      return sign*p/q;
-    }else if(y==1.0){
-      return sign*0.25*LOC::pi;
+      double p=y*P1[0]+y2*(P1[1]+y*P1[2])+y4*(P1[3]+y*P1[4])+y6*(P1[5]+y*P1[6])+y8*(P1[7]+y*P1[8]);
+      double q=Q1[0]+y*Q1[1]+y2*(Q1[2]+y*Q1[3])+y4*(Q1[4]+y*Q1[5])+y6*(Q1[6]+y*Q1[7])+y8*(Q1[8]+y*Q1[9]);
+      return p/q;
+    }else if(y==1){
+      return 0.25*pi;
     }else if(y<invtaylorswitch){
-      double c=sign*0.5*LOC::pi;
       double y2=y*y;
       double y4=y2*y2;
       double y6=y4*y2;
       double y8=y4*y4;
-      double p=LOC::P1[8]+y*LOC::P1[7]+y2*(LOC::P1[6]+y*LOC::P1[5])+y4*(LOC::P1[4]+y*LOC::P1[3])+y6*(LOC::P1[2]+y*LOC::P1[1])+y8*LOC::P1[0];
-      double q=LOC::Q1[9]+y*LOC::Q1[8]+y2*(LOC::Q1[7]+y*LOC::Q1[6])+y4*(LOC::Q1[5]+y*LOC::Q1[4])+y6*(LOC::Q1[3]+y*LOC::Q1[2])+y8*(LOC::Q1[1]+y*LOC::Q1[0]);
-      return -sign*p/q+c;
+      double p=P1[8]+y*P1[7]+y2*(P1[6]+y*P1[5])+y4*(P1[4]+y*P1[3])+y6*(P1[2]+y*P1[1])+y8*P1[0];
+      double q=Q1[9]+y*Q1[8]+y2*(Q1[7]+y*Q1[6])+y4*(Q1[5]+y*Q1[4])+y6*(Q1[3]+y*Q1[2])+y8*(Q1[1]+y*Q1[0]);
+      return -p/q+0.5*pi;
     }else{
-      double c=sign*0.5*LOC::pi;
       double yinv=1.0/y;
       double arctaninv=arctan_Taylor(yinv);
-      return -sign*arctaninv+c;
+      return -arctaninv+0.5*pi;
+    }
+  }
+  }
+
+  BEAVER_NODISCARD inline double  arctan(double x) noexcept {
+    namespace  LOC=internals::arctan;
+    //Catch non-finite input
+    if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
+    //x=+-0 and x=+-1 are handled by the kernel, which keeps unchecked::arctan bitwise identical
+    return std::copysign(LOC::kernel(std::fabs(x)),x);
+  }
+  // ----------- batch version over arrays -----------
+  inline void arctan(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=arctan(x[i]);
     }
   }
+  namespace unchecked {
+    //arctan without argument checks, caller guarantees finite x
+  BEAVER_NODISCARD inline double  arctan(double x) noexcept {
+    BEAVER_ASSUME(std::fabs(x) < std::numeric_limits<double>::infinity());
+    return std::copysign(internals::arctan::kernel(std::fabs(x)),x);
+  }
+  }
 }
 #endif
 
@@ -3,6 +3,8 @@
 #include "log.hpp"
 #include "config.hpp"
 #include <cmath>
+#include <cstddef>
+#include <limits>
 
 
 namespace beaver {
@@ -18,20 +20,13 @@ namespace beaver {
         double x2=x*x;
         return x-1.0/9*x2*x;
     }
-  BEAVER_NODISCARD inline double  atanint(double x) noexcept {
-    double taylorswitch=1e-4;//switch up to which an expansion about x=0 or x=1 is used. Guarantees precission for small y.
-    double invtaylorswitch=1/taylorswitch;
-    //Catch non-finite input
-    if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
-    if(x==0){
-      return 0.0;
-    }
-      // Branchless magnitude and sign
-    double   sign = std::copysign(1.0,x);
-    double   y=std::fabs(x);
-    //
+  namespace internals::atanint{
+    //Ti2 for finite y>=0, correctly rounded at y=1
+  inline double kernel(double y) noexcept {
+    const double taylorswitch=1e-4;//switch up to which an expansion about x=0 or x=1 is used. Guarantees precission for small y.
+    const double invtaylorswitch=1/taylorswitch;
     if(y<taylorswitch){
-      return sign*Ti2_Taylor(y);
+      return Ti2_Taylor(y);
     }else if(y<1){
       double y2=y*y;
       double y4=y2*y2;
@@ -39,27 +34,47 @@ namespace beaver {
       double y8=y4*y4;
       double p=y*P2[0]+y2*(P2[1]+y*P2[2])+y4*(P2[3]+y*P2[4])+y6*(P2[5]+y*P2[6])+y8*(P2[7]+y*P2[8]);
       double q=Q2[0]+y*Q2[1]+y2*(Q2[2]+y*Q2[3])+y4*(Q2[4]+y*Q2[5])+y6*(Q2[6]+y*Q2[7])+y8*(Q2[8]+y*Q2[9]);
-      return sign*p/q;
-    }else if(y==1.0){
-      return sign*catalan;
+      return p/q;
+    }else if(y==1){
+      return catalan;
     }else if(y<invtaylorswitch){
       double l=beaver::log(y);
-      double c=sign*0.5*pi*l;
+      double c=0.5*pi*l;
       double y2=y*y;
       double y4=y2*y2;
       double y6=y4*y2;
       double y8=y4*y4;
       double p=P2[8]+y*P2[7]+y2*(P2[6]+y*P2[5])+y4*(P2[4]+y*P2[3])+y6*(P2[2]+y*P2[1])+y8*P2[0];
       double q=Q2[9]+y*Q2[8]+y2*(Q2[7]+y*Q2[6])+y4*(Q2[5]+y*Q2[4])+y6*(Q2[3]+y*Q2[2])+y8*(Q2[1]+y*Q2[0]);
-      return sign*p/q+c;
+      return p/q+c;
     }else{
       double l=beaver::log(y);
-      double c=sign*0.5*pi*l;
+      double c=0.5*pi*l;
       double yinv=1.0/y;
       double ti2inv=Ti2_Taylor(yinv);
-      return sign*ti2inv+c;
+      return ti2inv+c;
+    }
+  }
+  }
+  BEAVER_NODISCARD inline double  atanint(double x) noexcept {
+    //Catch non-finite input
+    if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
+    //x=+-0 and x=+-1 are handled by the kernel, which keeps unchecked::atanint bitwise identical
+    return std::copysign(internals::atanint::kernel(std::fabs(x)),x);
+  }
+  // ----------- batch version over arrays -----------
+  inline void atanint(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=atanint(x[i]);
     }
   }
+  namespace unchecked {
+    //atanint without argument checks, caller guarantees finite x
+  BEAVER_NODISCARD inline double  atanint(double x) noexcept {
+    BEAVER_ASSUME(std::fabs(x) < std::numeric_limits<double>::infinity());
+    return std::copysign(internals::atanint::kernel(std::fabs(x)),x);
+  }
+  }
 }
 #endif
 
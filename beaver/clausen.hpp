@@ -0,0 +1,161 @@
+#ifndef BEAVER_CLAUSEN_HPP
+#define BEAVER_CLAUSEN_HPP
+#include "log.hpp"
+#include "log1p.hpp"
+#include "config.hpp"
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+
+namespace beaver {
+  namespace internals::clausen{
+    //universal constants
+  const double pi=3.1415926535897932385;
+  const double ln2=0.69314718055994530942;
+  const double zeta2=1.6449340668482264365;
+    //2*pi split into hi+lo for Cody-Waite range reduction
+  const double twopi_hi=6.283185307179586232;
+  const double twopi_lo=2.4492935982947063545e-16;
+  const double pi_hi=3.1415926535897931160;
+  const double pi_lo=1.2246467991473531772e-16;
+  const double inv_twopi=0.15915494309189533577;
+    //switch between the expansions about theta=0 and theta=pi
+  const double split=2.0943951023931954923;
+    //Pade-MiniMax numerator coefficients of (Cl2(t)-t(1-log t))/t^3 in u=t^2 on 0<t<2pi/3
+  const double PA[]={0.013888888888888888889,-0.00077625757601847375334,0.000015012721867505066427,-1.1699197121249338158e-7,3.14991551729002297e-10,-1.3557973982182315966e-13};
+    //Pade-MiniMax denominator coefficients of (Cl2(t)-t(1-log t))/t^3 in u=t^2 on 0<t<2pi/3
+  const double QA[]={1.0000000000000000000,-0.06089054547333011024,0.0013286793594233872161,-0.000012441693319654737507,4.6240518759652670756e-8,-4.5927561524770878999e-11};
+    //Pade-MiniMax numerator coefficients of (Cl2(pi-t)-t log 2)/t^3 in u=t^2 on 0<t<pi/3
+  const double PB[]={-0.041666666666666666667,0.0092421004197650353513,-0.00070689024429867173877,0.000021656550350406632493,-2.2669158781218749276e-7,3.6975501476571168412e-10};
+    //Pade-MiniMax denominator coefficients of (Cl2(pi-t)-t log 2)/t^3 in u=t^2 on 0<t<pi/3
+  const double QB[]={1.0000000000000000000,-0.24681041007436084843,0.021945149924550952465,-0.0008448352037895055264,0.000013120262369395865668,-5.6079160402328368353e-8};
+
+    //Reduce theta to (-pi,pi] (Cody-Waite with split 2pi). Exact for |theta| up to ~1e6.
+  inline double reduce(double theta) noexcept{
+    const double n=std::nearbyint(theta*inv_twopi);
+    return std::fma(-n,twopi_lo,std::fma(-n,twopi_hi,theta));
+  }
+    //(Cl2(t)-t(1-log t))/t^3 for 0<t<2pi/3 as a function of u=t^2
+  inline double small_ratio(double u) noexcept{
+    const double u2=u*u;
+    const double u4=u2*u2;
+    const double p=PA[0]+u*PA[1]+u2*(PA[2]+u*PA[3])+u4*(PA[4]+u*PA[5]);
+    const double q=QA[0]+u*QA[1]+u2*(QA[2]+u*QA[3])+u4*(QA[4]+u*QA[5]);
+    return p/q;
+  }
+    //(Cl2(pi-s)-s log 2)/s^3 for 0<s<=pi/3 as a function of u=s^2
+  inline double pi_ratio(double u) noexcept{
+    const double u2=u*u;
+    const double u4=u2*u2;
+    const double p=PB[0]+u*PB[1]+u2*(PB[2]+u*PB[3])+u4*(PB[4]+u*PB[5]);
+    const double q=QB[0]+u*QB[1]+u2*(QB[2]+u*QB[3])+u4*(QB[4]+u*QB[5]);
+    return p/q;
+  }
+    //Cl2(t) for 0<t<2pi/3
+  inline double cl2_zero(double t) noexcept{
+    const double u=t*t;
+    return std::fma(t*u,small_ratio(u),t*(1.0-beaver::log(t)));
+  }
+    //Cl2(pi-s) for 0<=s<=pi/3, expansion about pi: Cl2(pi-s)=s*log(2)+O(s^3)
+  inline double cl2_pi(double s) noexcept{
+    const double u=s*s;
+    return std::fma(s*u,pi_ratio(u),s*ln2);
+  }
+    //(R(v)-R(u))/(v-u) for R=P/Q of degree 5 without forming the difference: divided-difference Horner
+    //on numerator and denominator, so the slope keeps its relative accuracy for v->u
+  inline double ratio_slope(const double* P, const double* Q, double u, double v) noexcept{
+    double pu=P[5], pv=P[5], dp=0.0;
+    double qu=Q[5], qv=Q[5], dq=0.0;
+    for(int k=4;k>=0;--k){
+      dp=std::fma(u,dp,pv);
+      dq=std::fma(u,dq,qv);
+      pu=std::fma(pu,u,P[k]);
+      pv=std::fma(pv,v,P[k]);
+      qu=std::fma(qu,u,Q[k]);
+      qv=std::fma(qv,v,Q[k]);
+    }
+    return (dp*qu-pu*dq)/(qu*qv);
+  }
+    //Cl2(t+h)-Cl2(t) for pi/3<=t<pi and 0<=h<=1/4 as a sum of O(h) terms, in the expansion on the
+    //midpoint's side of the split (both stay accurate that far past it). Cl2(pi-s) is odd in s, so
+    //t+h>pi needs no folding.
+  inline double cl2_step(double t, double h) noexcept{
+    const double th=t+h;
+    if(t+0.5*h<split){
+      //t(1-log t) parts, then g(t)=t^3 r(t^2): g(th)-g(t)=(th^3-t^3) r(th^2)+t^3 (r(th^2)-r(t^2))
+      const double u=t*t;
+      const double uh=th*th;
+      const double lin=std::fma(h,1.0-beaver::log(th),-t*beaver::log1p(h/t));
+      return lin+h*(std::fma(th,th+t,u)*small_ratio(uh)+t*u*(th+t)*ratio_slope(PA,QA,u,uh));
+    }
+    //s=pi-t, sh=pi-t-h: s log 2 parts, then the same split of g(s)=s^3 R(s^2)
+    const double s=(pi_hi-t)+pi_lo;
+    const double sh=s-h;
+    const double v=s*s;
+    const double vh=sh*sh;
+    return -h*(ln2+std::fma(s,s+sh,vh)*pi_ratio(v)+sh*vh*(s+sh)*ratio_slope(PB,QB,vh,v));
+  }
+    //Cl2(theta) for finite theta. Near +-pi the distance s=pi-|t| to the reduced angle t=theta-2pi n
+    //is taken from theta itself, (2n+1)pi-theta for t>0 and theta-(2n-1)pi for t<0 in the Cody-Waite
+    //split of pi: t is rounded at ulp(pi), which would cost a small s its digits for |theta|>pi.
+  inline double cl2_reduced(double theta) noexcept{
+    const double n=std::nearbyint(theta*inv_twopi);
+    const double t=std::fma(-n,twopi_lo,std::fma(-n,twopi_hi,theta));
+    const double y=std::fabs(t);
+    if(y==0){
+      return 0.0;
+    }
+    if(y<split){
+      return std::copysign(cl2_zero(y),t);
+    }
+    const double k=(t>0) ? 2.0*n+1.0 : 2.0*n-1.0;
+    const double d=std::fma(-k,pi_lo,std::fma(-k,pi_hi,theta));//theta-k pi
+    return (t>0) ? cl2_pi(-d) : -cl2_pi(d);
+  }
+  }
+
+/**
+ * @brief function for the fast computation of the Clausen function
+ * @param theta: real angle
+ * @return \f$\mathrm{Cl}_2(\theta)=\mathrm{Im}\,\mathrm{Li}_2(e^{i\theta})\f$
+ */
+  BEAVER_NODISCARD inline double  clausen2(double theta) noexcept {
+    namespace  LOC=internals::clausen;
+    //Catch non-finite input
+    if (!std::isfinite(theta)) return std::numeric_limits<double>::quiet_NaN();
+    //periodic range reduction onto (-pi,pi], Cl2 is odd
+    return LOC::cl2_reduced(theta);
+  }
+
+/**
+ * @brief function for the fast computation of the dilogarithm on the unit circle
+ * @param theta: real angle
+ * @return \f$\mathrm{Li}_2(e^{i\theta})\f$, real part in closed form, imaginary part \f$\mathrm{Cl}_2(\theta)\f$
+ */
+  BEAVER_NODISCARD inline std::complex<double>  li2_unit_circle(double theta) noexcept {
+    namespace  LOC=internals::clausen;
+    //Catch non-finite input
+    if (!std::isfinite(theta)){
+      const double nan=std::numeric_limits<double>::quiet_NaN();
+      return {nan,nan};
+    }
+    const double y=std::fabs(LOC::reduce(theta));
+    //Re Li2(e^{i theta})=zeta2-|theta|(2pi-|theta|)/4 on the reduced interval
+    const double re=std::fma(-0.25*y,(LOC::twopi_hi-y)+LOC::twopi_lo,LOC::zeta2);
+    return {re,LOC::cl2_reduced(theta)};
+  }
+
+  // ----------- batch versions over arrays of angles -----------
+  inline void clausen2(const double* theta, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=clausen2(theta[i]);
+    }
+  }
+  inline void li2_unit_circle(const double* theta, std::complex<double>* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=li2_unit_circle(theta[i]);
+    }
+  }
+}
+#endif
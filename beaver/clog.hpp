@@ -0,0 +1,86 @@
+#ifndef BEAVER_CLOG_HPP
+#define BEAVER_CLOG_HPP
+#include "log.hpp"
+#include "log1p.hpp"
+#include "atan.hpp"
+#include "config.hpp"
+#include <cmath>
+#include <complex>
+#include <limits>
+
+namespace beaver {
+  // ----------- complex helpers shared by the complex-argument polylogarithms -----------
+  // Written out on real and imaginary parts so that no __muldc3-style library call
+  // (C99 Annex G) is emitted on the hot path.
+  namespace internals::clog{
+    //universal constants
+  const double pi=3.1415926535897932385;
+  const double pihalf=1.5707963267948966192;
+
+  inline std::complex<double> mul(std::complex<double> a, std::complex<double> b) noexcept{
+    return {a.real()*b.real()-a.imag()*b.imag(), a.real()*b.imag()+a.imag()*b.real()};
+  }
+  inline std::complex<double> sqr(std::complex<double> a) noexcept{
+    return {(a.real()-a.imag())*(a.real()+a.imag()), 2.0*a.real()*a.imag()};
+  }
+  inline std::complex<double> inv(std::complex<double> a) noexcept{
+    const double n=1.0/(a.real()*a.real()+a.imag()*a.imag());
+    return {a.real()*n, -a.imag()*n};
+  }
+    //Horner scheme of a real-coefficient polynomial c[0]+c[1]u+...+c[n-1]u^(n-1) at complex u
+  inline std::complex<double> horner(const double* c, int n, std::complex<double> u) noexcept{
+    std::complex<double> acc(c[n-1],0.0);
+    for(int k=n-2;k>=0;--k){
+      acc=mul(acc,u);
+      acc.real(acc.real()+c[k]);
+    }
+    return acc;
+  }
+    //atan2(y,x) on top of beaver::arctan (argument of arctan always in [-1,1])
+  inline double atan2(double y, double x) noexcept{
+    const double ax=std::fabs(x);
+    const double ay=std::fabs(y);
+    if(ay<=ax){
+      if(ax==0){//origin: follow the signed-zero convention of std::atan2
+        return std::signbit(x) ? std::copysign(pi,y) : y;
+      }
+      const double t=beaver::arctan(y/x);
+      return (x<0) ? t+std::copysign(pi,y) : t;
+    }
+    return std::copysign(pihalf,y)-beaver::arctan(x/y);
+  }
+    //log|z| without overflow/underflow of |z|^2 and accurate for |z| close to 1
+  inline double log_abs(double re, double im) noexcept{
+    const double n=re*re+im*im;
+    if(n>0.5 && n<2.0){
+      return 0.5*beaver::log1p(std::fma(re-1.0,re+1.0,im*im));
+    }
+    if(n>std::numeric_limits<double>::min() && n<std::numeric_limits<double>::max()){
+      return 0.5*beaver::log(n);
+    }
+    const double ar=std::fabs(re);
+    const double ai=std::fabs(im);
+    const double m=(ar>ai) ? ar : ai;
+    const double s=(ar>ai) ? ai/m : ar/m;
+    return beaver::log(m)+0.5*beaver::log1p(s*s);
+  }
+    //principal branch log(z)
+  inline std::complex<double> log(std::complex<double> z) noexcept{
+    return {log_abs(z.real(),z.imag()), atan2(z.imag(),z.real())};
+  }
+    //principal branch log(1+w), accurate for small |w| and for 1+w close to 0
+  inline std::complex<double> log1p(std::complex<double> w) noexcept{
+    const double wr=w.real();
+    const double wi=w.imag();
+    const double ar=1.0+wr;
+    double re;
+    if(std::fabs(wr)+std::fabs(wi)<0.5){
+      re=0.5*beaver::log1p(std::fma(wr,wr+2.0,wi*wi));
+    }else{
+      re=log_abs(ar,wi);
+    }
+    return {re, atan2(wi,ar)};
+  }
+  }
+}
+#endif
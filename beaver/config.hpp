@@ -7,8 +7,26 @@
   #define BEAVER_NODISCARD
 #endif
 
+// BEAVER_ASSUME(cond): checked in debug builds, an optimizer hint in release builds.
+// Only used where the caller has asserted cond (unchecked:: and region-tagged entry points);
+// a false cond there is undefined behaviour.
 #if defined(NDEBUG)
-  #define BEAVER_ASSUME(cond) ((void)0)
+  #if __cplusplus > 202002L && defined(__has_cpp_attribute)
+    #if __has_cpp_attribute(assume)
+      #define BEAVER_HAS_CPP_ASSUME
+    #endif
+  #endif
+  #if defined(BEAVER_HAS_CPP_ASSUME)
+    #define BEAVER_ASSUME(cond) [[assume(cond)]]
+  #elif defined(__clang__)
+    #define BEAVER_ASSUME(cond) __builtin_assume(cond)
+  #elif defined(__GNUC__)
+    #define BEAVER_ASSUME(cond) do { if (!(cond)) __builtin_unreachable(); } while (0)
+  #elif defined(_MSC_VER)
+    #define BEAVER_ASSUME(cond) __assume(cond)
+  #else
+    #define BEAVER_ASSUME(cond) ((void)0)
+  #endif
 #else
   #include <cassert>
   #define BEAVER_ASSUME(cond) assert(cond)
@@ -1,14 +1,22 @@
 #ifndef BEAVER_DILOG_HPP
 #define BEAVER_DILOG_HPP
 #include "log.hpp"
+#include "clog.hpp"
 #include "config.hpp"
+#include "region.hpp"
 #include <cmath>
+#include <complex>
+#include <cstddef>
 
 namespace beaver {
   namespace internals::dilog{
     //universal constants
   const double ln2=0.69314718055994530942;
   const double zeta2=1.6449340668482264365;
+    //switch up to which an expansion about x=0 or x=1 is used. Guarantees precision for small y.
+  const double taylorswitch=1e-4;
+    //complex argument: |Im z|<strip*min(|x|,|1-x|) uses the first-order expansion about the real axis
+  const double strip=1e-8;
   //MiniMax numerator coefficients of log(1-x)/x
   const double P1[]={-0.9999999999999998672,2.7601168443679114620,-2.7923621883637091036,1.2497503713725827027,-0.23173044836039025061,0.012188323559602391476};
     //MiniMax denominator coefficients of log(1-x)/x
@@ -21,6 +29,15 @@ namespace beaver {
   const double P2b[]={0.9999999999999999277,-2.1758446306576192119,1.6555942695751114745,-0.52288981465311876594,0.062597549060802191130,-0.0018723824826943140006};        
   //MiniMax denominator coefficients of Li2(x)/x on -1<x<10^(-4)
   const double Q2b[]={1.0000000000000000000,-2.4258446306575919627,2.1509443161301692038,-0.85358760134515718081,0.14861592651355131752,-0.0093613047200351782876,0.00011533394212474942253}; 
+    //Bernoulli coefficients B_2k/(2k+1)!, k=1..10, of Li2(1-exp(-u))=u-u^2/4+sum_k B_2k/(2k+1)! u^(2k+1) (|u|<=pi/3)
+  const double B[]={0.027777777777777777778,-0.00027777777777777777778,4.7241118669690098262e-6,-9.1857730746619635509e-8,1.8978869988970999072e-9,-4.0647616451442255268e-11,8.9216910204564525552e-13,-1.9939295860721075687e-14,4.5189800296199181917e-16,-1.0356517612181247014e-17};
+    //Li2 Bernoulli kernel in u=-log(1-z) for |z|<=1, Re(z)<=1/2
+  inline std::complex<double> Li2_Bernoulli(std::complex<double> u) noexcept{
+    namespace  C=internals::clog;
+    const std::complex<double> u2=C::sqr(u);
+    const std::complex<double> s=C::horner(B,10,u2);
+    return u-0.25*u2+C::mul(C::mul(u,u2),s);
+  }
      //Li2 kernel around x=0
   }
   static double Li2_Taylor(double x){
@@ -28,73 +45,99 @@ namespace beaver {
         double x4=x2*x2;
         return x+(1.0/4+1.0/9*x)*x2+1.0/16*x4;
     }
-    BEAVER_NODISCARD inline double  dilog(double x) noexcept {
-    namespace  LOC=internals::dilog;
-    double taylorswitch=1e-4;//switch up to which an expansion about x=0 or x=1 is used. Guarantees precission for small y.
-    double invtaylorswitch=1/taylorswitch;
-  //Catch non-finite input
-  if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
-  if(x<-invtaylorswitch){
-    double l=beaver::log(-x);
-    double c=-LOC::zeta2-1.0/2*l*l;
-    double xinv=1.0/x;
-    double li2inv=Li2_Taylor(xinv);
-    return -li2inv+c;
-  }else if(x<-1){
-    double l=beaver::log(-x);
-    double c=-LOC::zeta2-1.0/2*l*l;
-    double x2=x*x;
-    double x4=x2*x2;
-    double x6=x4*x2;
-    double p=LOC::P2b[5]+x*LOC::P2b[4]+x2*(LOC::P2b[3]+x*LOC::P2b[2])+x4*(LOC::P2b[1]+x*LOC::P2b[0]);
-    double q=LOC::Q2b[6]+x*LOC::Q2b[5]+x2*(LOC::Q2b[4]+x*LOC::Q2b[3])+x4*(LOC::Q2b[2]+x*LOC::Q2b[1])+x6*LOC::Q2b[0];
-    return -p/q+c;
-  }else if(x==-1){
-    return -0.5*LOC::zeta2;
-  }else if(x<-taylorswitch){
+  namespace internals::dilog{
+    //Li2 on -1<=x<=0: (6,6) MiniMax
+  inline double negative_unit(double x) noexcept{
     double x2=x*x;
     double x4=x2*x2;
     double x6=x4*x2;
-    double p=x*LOC::P2b[0]+x2*(LOC::P2b[1]+x*LOC::P2b[2])+x4*(LOC::P2b[3]+x*LOC::P2b[4])+x6*LOC::P2b[5];
-    double q=LOC::Q2b[0]+x*LOC::Q2b[1]+x2*(LOC::Q2b[2]+x*LOC::Q2b[3])+x4*(LOC::Q2b[4]+x*LOC::Q2b[5])+x6*LOC::Q2b[6];
+    double p=x*P2b[0]+x2*(P2b[1]+x*P2b[2])+x4*(P2b[3]+x*P2b[4])+x6*P2b[5];
+    double q=Q2b[0]+x*Q2b[1]+x2*(Q2b[2]+x*Q2b[3])+x4*(Q2b[4]+x*Q2b[5])+x6*Q2b[6];
     return p/q;
-  }else if(x<taylorswitch){
-    return Li2_Taylor(x);
-  }else if(x<0.5){
+  }
+    //Li2 on 0<=x<=0.5: (6,6) MiniMax
+  inline double lower_half(double x) noexcept{
     double x2=x*x;
     double x4=x2*x2;
     double x6=x4*x2;
-    double p=x*LOC::P2a[0]+x2*(LOC::P2a[1]+x*LOC::P2a[2])+x4*(LOC::P2a[3]+x*LOC::P2a[4])+x6*LOC::P2a[5];
-    double q=LOC::Q2a[0]+x*LOC::Q2a[1]+x2*(LOC::Q2a[2]+x*LOC::Q2a[3])+x4*(LOC::Q2a[4]+x*LOC::Q2a[5])+x6*LOC::Q2a[6];
+    double p=x*P2a[0]+x2*(P2a[1]+x*P2a[2])+x4*(P2a[3]+x*P2a[4])+x6*P2a[5];
+    double q=Q2a[0]+x*Q2a[1]+x2*(Q2a[2]+x*Q2a[3])+x4*(Q2a[4]+x*Q2a[5])+x6*Q2a[6];
     return p/q;
-  }else if(x==0.5)
-  {
-    return 0.5*LOC::zeta2-0.5*LOC::ln2*LOC::ln2;
-  }else if(x<1-taylorswitch){
-    double y=1-x;
+  }
+    //Li2(1-y) on 0<y<=0.5: zeta2-log(1-y)log(y)-Li2(y)
+  inline double reflected(double y) noexcept{
+    BEAVER_ASSUME(y > 0.0);
     double y2=y*y;
     double y4=y2*y2;
     double y6=y2*y4;
     double ly=beaver::log(y);
     //calculate l=log(x) with MiniMax (argument is guaranteed to be between 0.5 and 1)
     //double l=beaver::log(x); //is slower
-    double pl=y*LOC::P1[0]+y2*std::fma(LOC::P1[2],y,LOC::P1[1])+y4*std::fma(LOC::P1[4],y,LOC::P1[3])+y6*LOC::P1[5];
-    double ql=LOC::Q1[0]+y*LOC::Q1[1]+y2*std::fma(LOC::Q1[3],y,LOC::Q1[2])+y4*std::fma(LOC::Q1[5],y,LOC::Q1[4])+y6*LOC::Q1[6];
+    double pl=y*P1[0]+y2*std::fma(P1[2],y,P1[1])+y4*std::fma(P1[4],y,P1[3])+y6*P1[5];
+    double ql=Q1[0]+y*Q1[1]+y2*std::fma(Q1[3],y,Q1[2])+y4*std::fma(Q1[5],y,Q1[4])+y6*Q1[6];
     double l=pl/ql;
-    double l2=l*l;
-    double l3=l2*l;
-    double c=LOC::zeta2-l*ly;
-    double p=y*LOC::P2a[0]+y2*(LOC::P2a[1]+y*LOC::P2a[2])+y4*(LOC::P2a[3]+y*LOC::P2a[4])+y6*LOC::P2a[5];
-    double q=LOC::Q2a[0]+y*LOC::Q2a[1]+y2*(LOC::Q2a[2]+y*LOC::Q2a[3])+y4*(LOC::Q2a[4]+y*LOC::Q2a[5])+y6*LOC::Q2a[6];
+    double c=zeta2-l*ly;
+    double p=y*P2a[0]+y2*(P2a[1]+y*P2a[2])+y4*(P2a[3]+y*P2a[4])+y6*P2a[5];
+    double q=Q2a[0]+y*Q2a[1]+y2*(Q2a[2]+y*Q2a[3])+y4*(Q2a[4]+y*Q2a[5])+y6*Q2a[6];
     return -p/q+c;
-  } else if(x<1){
-    double y=1-x;
+  }
+    //Li2(1-y) for 0<y<10^(-4): expansion about x=1
+  inline double near_one(double y) noexcept{
     double y2=y*y;
     double y4=y2*y2;
     double ly=beaver::log(y);
-    double taylor=LOC::zeta2-y-y2*(0.25+1.0/9*y)-1.0/16*y4;
+    double taylor=zeta2-y-y2*(0.25+1.0/9*y)-1.0/16*y4;
     double logtaylor=y+y2*(1.0/2+1.0/3*y)+1.0/4*y4;
     return taylor+ly*logtaylor;
+  }
+    //Li2 on x<-1: -Li2(1/x)-zeta2-1/2 log^2(-x), Taylor in 1/x for x<-1/taylorswitch, else the
+    //MiniMax of -1<=x<=0 with reversed coefficients, i.e. evaluated at 1/x without the division
+  inline double on_below_minus_one(double x) noexcept{
+    double l=beaver::log(-x);
+    double c=-zeta2-1.0/2*l*l;
+    if(x<-1/taylorswitch){
+      return -Li2_Taylor(1.0/x)+c;
+    }
+    double x2=x*x;
+    double x4=x2*x2;
+    double x6=x4*x2;
+    double p=P2b[5]+x*P2b[4]+x2*(P2b[3]+x*P2b[2])+x4*(P2b[1]+x*P2b[0]);
+    double q=Q2b[6]+x*Q2b[5]+x2*(Q2b[4]+x*Q2b[3])+x4*(Q2b[2]+x*Q2b[1])+x6*Q2b[0];
+    return -p/q+c;
+  }
+    //Li2 on -1<=x<=0
+  inline double on_negative_unit(double x) noexcept{
+    if(x==-1){
+      return -0.5*zeta2;
+    }
+    return (x<-taylorswitch) ? negative_unit(x) : Li2_Taylor(x);
+  }
+    //Li2 on 0<=x<=0.5
+  inline double on_lower_half(double x) noexcept{
+    if(x<taylorswitch){
+      return Li2_Taylor(x);
+    }
+    return (x<0.5) ? lower_half(x) : 0.5*zeta2-0.5*ln2*ln2;
+  }
+    //Li2 on 0.5<x<1
+  inline double on_upper_half(double x) noexcept{
+    return (x<1-taylorswitch) ? reflected(1-x) : near_one(1-x);
+  }
+  }
+    //The checked function, the region tags and unchecked::dilog share the on_<region> kernels above,
+    //so all of them give identical results wherever their domains overlap.
+    BEAVER_NODISCARD inline double  dilog(double x) noexcept {
+    namespace  LOC=internals::dilog;
+  //Catch non-finite input
+  if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
+  if(x<-1){
+    return LOC::on_below_minus_one(x);
+  }else if(x<=0){
+    return LOC::on_negative_unit(x);
+  }else if(x<=0.5){
+    return LOC::on_lower_half(x);
+  }else if(x<1){
+    return LOC::on_upper_half(x);
   }else if(x==1){
     return LOC::zeta2;
   }else{//Argument on branch-cut
@@ -102,5 +145,144 @@ namespace beaver {
   }
 }
 
+  // ----------- batch version over arrays -----------
+  inline void dilog(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=dilog(x[i]);
+    }
+  }
+
+/**
+ * @brief function for the fast computation of the dilogarithm at complementary argument
+ * @param y: real argument, y=1-x
+ * @return \f$\mathrm{Li}_2(1-y)\f$, without rounding 1-y near x=1
+ */
+  BEAVER_NODISCARD inline double  dilog_1m(double y) noexcept {
+    namespace  LOC=internals::dilog;
+  //Catch non-finite input
+  if (!std::isfinite(y)) return std::numeric_limits<double>::quiet_NaN();
+  if(y<0){//Argument on branch-cut
+    return std::numeric_limits<double>::quiet_NaN();
+  }else if(y==0){
+    return LOC::zeta2;
+  }else if(y<LOC::taylorswitch){
+    return LOC::near_one(y);
+  }else if(y<0.5){
+    return LOC::reflected(y);
+  }
+  //x=1-y<=0.5 is exact for y<=2, beyond that x carries the full relative precision of y
+  return dilog(1-y);
+}
+  inline void dilog_1m(const double* y, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=dilog_1m(y[i]);
+    }
+  }
+
+  // ----------- region-tagged entry points: no validation, caller asserts finite x in the region -----------
+  BEAVER_NODISCARD inline double  dilog(double x, region::below_minus_one_t) noexcept {
+    BEAVER_ASSUME(x < -1.0);
+    return internals::dilog::on_below_minus_one(x);
+  }
+  BEAVER_NODISCARD inline double  dilog(double x, region::negative_unit_t) noexcept {
+    BEAVER_ASSUME(x >= -1.0 && x <= 0.0);
+    return internals::dilog::on_negative_unit(x);
+  }
+  BEAVER_NODISCARD inline double  dilog(double x, region::lower_half_t) noexcept {
+    BEAVER_ASSUME(x >= 0.0 && x <= 0.5);
+    return internals::dilog::on_lower_half(x);
+  }
+  BEAVER_NODISCARD inline double  dilog(double x, region::upper_half_t) noexcept {
+    BEAVER_ASSUME(x > 0.5 && x < 1.0);
+    return internals::dilog::on_upper_half(x);
+  }
+  BEAVER_NODISCARD inline double  dilog(double x, region::unit_interval_t) noexcept {
+    BEAVER_ASSUME(x > 0.0 && x < 1.0);
+    return (x<=0.5) ? internals::dilog::on_lower_half(x) : internals::dilog::on_upper_half(x);
+  }
+  template<class Region>
+  inline void dilog(const double* x, double* out, std::size_t n, Region r) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=dilog(x[i],r);
+    }
+  }
+
+  namespace unchecked {
+    //dilog without argument checks, caller guarantees finite x<1
+  BEAVER_NODISCARD inline double  dilog(double x) noexcept {
+    namespace  LOC=internals::dilog;
+    BEAVER_ASSUME(x < 1.0);
+    if(x<-1) return LOC::on_below_minus_one(x);
+    if(x<=0) return LOC::on_negative_unit(x);
+    if(x<=0.5) return LOC::on_lower_half(x);
+    return LOC::on_upper_half(x);
+  }
+  inline void dilog(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=dilog(x[i]);
+    }
+  }
+  }
+
+/**
+ * @brief function for the fast computation of the dilogarithm at complex argument
+ * @param z: complex argument (principal branch, cut along [1,inf), Im z=+-0 selects the side)
+ * @return \f$\mathrm{Li}_2(z)\f$
+ */
+  BEAVER_NODISCARD inline std::complex<double>  dilog(std::complex<double> z) noexcept {
+    namespace  LOC=internals::dilog;
+    namespace  C=internals::clog;
+    const double rz=z.real();
+    const double iz=z.imag();
+    //Catch non-finite input
+    if (!std::isfinite(rz) || !std::isfinite(iz)){
+      const double nan=std::numeric_limits<double>::quiet_NaN();
+      return {nan,nan};
+    }
+    //real axis: reuse the real fast path, continue across the cut for x>1
+    if(iz==0){
+      if(rz<=1){
+        return {beaver::dilog(rz), iz};
+      }
+      const double l=beaver::log(rz);
+      return {2*LOC::zeta2-0.5*l*l-beaver::dilog(1.0/rz), std::copysign(C::pi*l,iz)};
+    }
+    //strip along the real axis: Li2(x+iy)=Li2(x)+iy Li2'(x)+O(y^2) with Li2'(x)=-log(1-x)/x,
+    //so Im Li2 keeps its relative accuracy as y->0 and Re comes from the real MiniMax kernels.
+    //On the cut x>1 log(1-x)=log(x-1)-+i pi, which adds -pi|y|/x to Re
+    if(std::fabs(iz)<LOC::strip*std::fmin(std::fabs(rz),std::fabs(1.0-rz))){
+      if(rz<1){
+        return {beaver::dilog(rz), -iz*beaver::log1p(-rz)/rz};
+      }
+      const double l=beaver::log(rz);
+      const double re=2*LOC::zeta2-0.5*l*l-beaver::dilog(1.0/rz);
+      return {std::fma(-C::pi*std::fabs(iz),1.0/rz,re), std::fma(-iz,beaver::log(rz-1.0)/rz,std::copysign(C::pi*l,iz))};
+    }
+    const double nz=rz*rz+iz*iz;
+    if(rz<=0.5){
+      if(nz<=1){
+        return LOC::Li2_Bernoulli(-C::log1p(-z));
+      }
+      //Li2(z)=-Li2(1/z)-zeta2-1/2 log^2(-z)
+      const std::complex<double> lmz=C::log(-z);
+      return -LOC::Li2_Bernoulli(-C::log1p(-C::inv(z)))-LOC::zeta2-0.5*C::sqr(lmz);
+    }
+    if(nz<=2*rz){
+      //|1-z|<=1: Li2(z)=-Li2(1-z)+zeta2-log(z)log(1-z)
+      const std::complex<double> lz=C::log1p({rz-1.0,iz});
+      const std::complex<double> l1mz=C::log1p(-z);
+      return -LOC::Li2_Bernoulli(-lz)+LOC::zeta2-C::mul(lz,l1mz);
+    }
+    const std::complex<double> lmz=C::log(-z);
+    return -LOC::Li2_Bernoulli(-C::log1p(-C::inv(z)))-LOC::zeta2-0.5*C::sqr(lmz);
+  }
+
+  // ----------- batch version over arrays of complex arguments -----------
+  inline void dilog(const std::complex<double>* z, std::complex<double>* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=dilog(z[i]);
+    }
+  }
+
 }
-#endif
\ No newline at end of file
+#endif
@@ -6,6 +6,7 @@
 #include <cstring>
 #include <cmath>
 #include <limits>
+#include <cstddef>
 
 namespace beaver {
 // LOC::Precomputed 128-bin table over [1,2): c[i] = 1 + i/128.
@@ -136,21 +137,11 @@ namespace internals::log{
      1.0000000000000000000,3.0243179484844478984,3.4693823340320569110,1.8712008107589969119,
      0.47414221544030897129,0.048197392940493293520,0.0011708757538544673621};
 }
-  // ----------- fast log(double)  (C++11 header-only, uses pre-computed tables for |1-x|>=0.25 else a MiniMax rational) -----------
-/**
- * @brief function for the fast computation of the logarithm
- * @param x: real argument >0
- * @return \f$\log(x)\f$
- */
-BEAVER_NODISCARD inline double log(double x) noexcept {
-    namespace  LOC=internals::log;
-    // Specials (predictable branch)
-    BEAVER_ASSUME(x > 0.0);
-    if (x == 0.0) return -std::numeric_limits<double>::infinity();
-    if (x <  0.0) return std::numeric_limits<double>::quiet_NaN();
-
-    double y  = x - 1.0;           // small if x near 1.
-if (std::fabs(y) >= 0.25){ 
+namespace internals::log{
+  // ----------- table kernel: log(x+dx) for normal or subnormal x>0 and |dx|<<x -----------
+  // dx carries the rounding error of x when x is itself the rounded result of a sum
+  // (see beaver::log1p); plain log passes dx=0.
+  inline double table(double x, double dx) noexcept {
     // Bit-cast
     std::uint64_t bits;
     std::memcpy(&bits, &x, sizeof(bits));
@@ -160,6 +151,7 @@ if (std::fabs(y) >= 0.25){
     if (e == 0) {
         // Subnormal: normalize by 2^54 (C++11-friendly)
         x *= std::ldexp(1.0, 54);
+        dx *= std::ldexp(1.0, 54);
         std::memcpy(&bits, &x, sizeof(bits));
         e = std::int32_t((bits >> 52) & 0x7FF) - 54;
     }
@@ -170,6 +162,12 @@ if (std::fabs(y) >= 0.25){
     double m;
     std::memcpy(&m, &bits, sizeof(m));
 
+    // 2^-k to scale dx like m (exact); clamped to the normal range, outside of which
+    // dx is zero or negligible against x
+    const std::int32_t ks = k < -1022 ? -1022 : (k > 1022 ? 1022 : k);
+    const std::uint64_t sbits = std::uint64_t(1023 - ks) << 52;
+    double scale;
+    std::memcpy(&scale, &sbits, sizeof(scale));
 
     // ---------------- 128-bin indexing: top 7 mantissa bits -> 128 buckets ---------------
     const int i128  = int((bits >> (52 - 7)) & 0x7F);
@@ -178,8 +176,8 @@ if (std::fabs(y) >= 0.25){
     const double log_hi   = BEAVER_LOGC_HI[i128];
     const double log_lo   = BEAVER_LOGC_LO[i128];
 
-    // r = m / c[i] - 1, NO divide (uses precomputed reciprocal)
-    const double r = std::fma(m, invc, -1.0);
+    // r = (m+dm) / c[i] - 1, NO divide (uses precomputed reciprocal)
+    const double r = std::fma(dx * scale, invc, std::fma(m, invc, -1.0));
 
     // ------------------ Original 128-bin tiny-kernel (your R6 variant) ------------------
     // log1p(r) ≈ r - r^2/2 + r^3/3 - r^4/4 + r^5/5 - r^6/6  (grouped Estrin as before)
@@ -196,30 +194,66 @@ if (std::fabs(y) >= 0.25){
     const double y_hi = std::fma(double(k), LN2_HI, log_hi);
     const double y_lo = std::fma(double(k), LN2_LO, log_lo + p);
     return y_hi + y_lo;
-}
+  }
+
+  // ----------- kernel for finite x>0: tables for |1-x|>=0.25 else a MiniMax rational -----------
+  inline double kernel(double x) noexcept {
+    double y  = x - 1.0;           // small if x near 1.
+    if (std::fabs(y) >= 0.25){
+        return table(x, 0.0);
+    }
     //For x close to 1 use a MiniMax (range determined s.t. a (6,6) rational suffices).
     //(6,6) MiniMax approximation for 0.75<x<1.25
-    // LOC::Powers (y=x-1): y^2, y^4, y^6
+    // Powers (y=x-1): y^2, y^4, y^6
     double y2 = y * y;
     double y4 = y2 * y2;
     double y6 = y4 * y2;
 
     // Numerator p:
-    // p = y*LOC::P0 + y2*(LOC::P1 + y*LOC::P2) + y4*(LOC::P3 + y*LOC::P4) + y6*LOC::P5
-    double p = std::fma(y6, LOC::P[5],
-               std::fma(y4, std::fma(y, LOC::P[4], LOC::P[3]),
-               std::fma(y2, std::fma(y, LOC::P[2], LOC::P[1]),y * LOC::P[0])));
+    // p = y*P0 + y2*(P1 + y*P2) + y4*(P3 + y*P4) + y6*P5
+    double p = std::fma(y6, P[5],
+               std::fma(y4, std::fma(y, P[4], P[3]),
+               std::fma(y2, std::fma(y, P[2], P[1]),y * P[0])));
 
     // Denominator q:
-    // q = LOC::Q0 + t*LOC::Q1 + t2*(LOC::Q2 + t*LOC::Q3) + t4*(LOC::Q4 + t*LOC::Q5) + t6*LOC::Q6
-    double q = std::fma(y6, LOC::Q[6],
-               std::fma(y4, std::fma(y, LOC::Q[5], LOC::Q[4]),
-               std::fma(y2, std::fma(y, LOC::Q[3], LOC::Q[2]),
-               std::fma(y,  LOC::Q[1], LOC::Q[0]))));
+    // q = Q0 + t*Q1 + t2*(Q2 + t*Q3) + t4*(Q4 + t*Q5) + t6*Q6
+    double q = std::fma(y6, Q[6],
+               std::fma(y4, std::fma(y, Q[5], Q[4]),
+               std::fma(y2, std::fma(y, Q[3], Q[2]),
+               std::fma(y,  Q[1], Q[0]))));
 
     // Division is fine here—latency hides across the next loop trip.
     return p/q;
 
+  }
+}
+  // ----------- fast log(double)  (C++11 header-only, uses pre-computed tables for |1-x|>=0.25 else a MiniMax rational) -----------
+/**
+ * @brief function for the fast computation of the logarithm
+ * @param x: real argument >0
+ * @return \f$\log(x)\f$
+ */
+BEAVER_NODISCARD inline double log(double x) noexcept {
+    // Specials (predictable branch)
+    if (x == 0.0) return -std::numeric_limits<double>::infinity();
+    if (x <  0.0) return std::numeric_limits<double>::quiet_NaN();
+    return internals::log::kernel(x);
+}
+namespace unchecked {
+/**
+ * @brief log without argument checks
+ * @param x: real argument, caller guarantees 0<x<inf
+ */
+BEAVER_NODISCARD inline double log(double x) noexcept {
+    BEAVER_ASSUME(x > 0.0);
+    return internals::log::kernel(x);
+}
+}
+  // ----------- batch version over arrays -----------
+inline void log(const double* x, double* out, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = log(x[i]);
+    }
 }
 } // namespace beaver
 #endif // BEAVER_LOG_HLOC::PLOC::P
@@ -3,53 +3,78 @@
 #include "log.hpp"
 #include "config.hpp"
 #include <cmath>
+#include <cstddef>
+#include <limits>
 
 
 namespace beaver {
   namespace internals::log1p{
-    //MiniMax numerator coefficients of arctan(x)/x on -0.3<x<0.3
+    //MiniMax numerator coefficients of log(1+x) on -0.3<x<0.3
   const double P1[]={1.0000000000000000088,2.5354992169744272295,2.3128650957787127388,0.90911801705539161145,0.14229189572592744963,0.0059080279683984783396};
-      //MiniMax denominator coefficients of arctan(x)/x on -0.3<x<0.3
+      //MiniMax denominator coefficients of log(1+x) on -0.3<x<0.3
   const double Q1[]={1.0000000000000000000,3.0354992169744259496,3.4972813709325962709,1.8959256301972141936,0.48336905809034197355,0.049504512928543790754,0.0012137637778754891357};
+  const double logswitch=0.3;
+  const double taylorswitch=1e-3;
+    //Taylor series through x^6 for |x|<taylorswitch: truncation below 2e-19 relative and x added last, so within 0.51 ulp
+  inline double taylor(double x) noexcept{
+    double x2=x*x;
+    double x4=x2*x2;
+    return x+(x2*(-1.0/2+1.0/3*x)+x4*(-1.0/4+x*(1.0/5-1.0/6*x)));
   }
-   //log(1+x) kernel around x=0
-  static double log1p_Taylor(double x){
-        double x2=x*x;
-        double x4=x2*x2;
-        return x+x2*(-1.0/2+1.0/3*x)+x4*(-1.0/4+1.0/5*x);
+    //Main path around x=0 (|x|<logswitch): (6,6) MiniMax, Taylor series for |x|<taylorswitch
+  inline double small(double x) noexcept{
+    if(std::fabs(x)<taylorswitch){
+      return taylor(x);
     }
+    double x2=x*x;
+    double x4=x2*x2;
+    double x6=x4*x2;
+    double p=x*P1[0]+x2*(P1[1]+x*P1[2])+x4*(P1[3]+x*P1[4])+x6*P1[5];
+    double q=Q1[0]+x*Q1[1]+x2*(Q1[2]+x*Q1[3])+x4*(Q1[4]+x*Q1[5])+x6*Q1[6];
+    return p/q;
+  }
+    //finite x>-1 away from 0: u=1+x rounded, du its exact rounding error (2Sum), fed to the 128-bin table reduction
+  inline double large(double x) noexcept{
+    const double u=1.0+x;
+    const double xb=u-x;
+    const double du=(1.0-xb)+(x-(u-xb));
+    return internals::log::table(u,du);
+  }
+  }
   BEAVER_NODISCARD inline double  log1p(double x) noexcept {
     namespace  LOC=internals::log1p;
-    double taylorswitch=1e-3;//switch up to which an expansion about x=0 . Guarantees precission for small x.
-    double logswitch=0.3;
-    //Catch non-finite input
-    if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
-    if(x==0){
-      return 0.0;
+    if(std::fabs(x)<LOC::logswitch){
+      return LOC::small(x);
     }
-    if(x==-1){
-      return -INFINITY;
+    //Catch non-finite input and the branch-cut (NaN also lands here)
+    if(!(x>-1) || !std::isfinite(x)){
+      return (x==-1) ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
     }
-    //on branch-cut
-    if(x<-1){
-      return NAN;
+    return LOC::large(x);
+  }
+    //log(1-y) for callers holding y=1-x exactly (negation is exact, so no rounding of 1-y)
+  BEAVER_NODISCARD inline double  log1m(double y) noexcept {
+    return log1p(-y);
+  }
+  namespace unchecked {
+    //log1p without argument checks, caller guarantees finite x>-1
+  BEAVER_NODISCARD inline double  log1p(double x) noexcept {
+    namespace  LOC=internals::log1p;
+    BEAVER_ASSUME(x > -1.0);
+    return (std::fabs(x)<LOC::logswitch) ? LOC::small(x) : LOC::large(x);
+  }
+  }
+
+  // ----------- batch version over arrays -----------
+  inline void log1p(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=log1p(x[i]);
     }
-      // Branchless magnitude and sign
-    double   y=std::fabs(x);
-    //
-    if(y<taylorswitch){
-      return log1p_Taylor(x);
-    }else if(y<logswitch){
-        double x2=x*x;
-      double x4=x2*x2;
-      double x6=x4*x2;
-      double p=x*LOC::P1[0]+x2*(LOC::P1[1]+x*LOC::P1[2])+x4*(LOC::P1[3]+x*LOC::P1[4])+x6*LOC::P1[5];
-      double q=LOC::Q1[0]+x*LOC::Q1[1]+x2*(LOC::Q1[2]+x*LOC::Q1[3])+x4*(LOC::Q1[4]+x*LOC::Q1[5])+x6*LOC::Q1[6];
-      return p/q;
-    }else{
-      return beaver::log(1+x);
+  }
+  inline void log1m(const double* y, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=log1m(y[i]);
     }
   }
 }
 #endif
-
@@ -1,6 +1,15 @@
 #ifndef BEAVER_POW_HPP
 #define BEAVER_POW_HPP
+#include <array>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#if __cplusplus >= 202002L && __has_include(<span>)
+  #include <span>
+  #define BEAVER_HAS_SPAN
+#endif
 
 namespace beaver {
 
@@ -34,6 +43,42 @@ constexpr T pow(T x) noexcept {
 }
 
 
+//---------------------------------------------
+// 1b) Power ladder: powers<N>(x) = {1, x, x^2, ..., x^N}
+//    Minimum-depth product tree: x^k = x^h * x^(k-h) with h the largest
+//    power of two below k, so x^k sits ceil(log2 k) multiplies deep and
+//    the whole ladder costs N-1 multiplies.
+//---------------------------------------------
+namespace detail {
+    constexpr int ladder_split(int k) noexcept {
+        int h = 1;
+        while (2 * h < k) h *= 2;
+        return h;
+    }
+    template<class T, std::size_t... I>
+    inline __attribute__((always_inline))
+    constexpr void fill_ladder(std::array<T, sizeof...(I) + 2>& p, std::index_sequence<I...>) noexcept {
+        // comma fold: evaluated left to right, x^k only reads lower powers
+        ((p[I + 2] = p[ladder_split(I + 2)] * p[I + 2 - ladder_split(I + 2)]), ...);
+    }
+}
+
+template<int N, class T>
+inline __attribute__((always_inline))
+constexpr std::array<T, N + 1> powers(T x) noexcept {
+    static_assert(N >= 0, "powers<N>: N must be non-negative");
+    std::array<T, N + 1> p{};
+    p[0] = T{1};
+    if constexpr (N >= 1) {
+        p[1] = x;
+    }
+    if constexpr (N >= 2) {
+        detail::fill_ladder<T>(p, std::make_index_sequence<N - 1>{});
+    }
+    return p;
+}
+
+
 //---------------------------------------------
 // 2) Integer-base exact power (wraparound):
 //    ipow(T base, unsigned n)
@@ -55,31 +100,50 @@ ipow(T x, unsigned n) noexcept {
 
 //---------------------------------------------
 // 3) Runtime exponent: pow(x, n)
-//    - Floating bases: binary exp for small |n|, else std::pow.
-//    - Integral bases: promote to double/long double and use floating route,
+//    - Floating bases: |n| <= POW_STDPOW_CUTOFF is one indirect call through
+//      detail::pow_table into the unrolled pow<N>, larger |n| goes to std::pow.
+//    - Integral bases: promote to long double and take the floating route,
 //      unless the caller explicitly chose ipow().
 //---------------------------------------------
 namespace detail {
+    // Jump tables over the unrolled pow<N> for 0 <= N <= POW_STDPOW_CUTOFF:
+    // one indirect call instead of a data-dependent square-and-multiply loop.
+    template<class T, std::size_t... I>
+    constexpr std::array<T (*)(T) noexcept, sizeof...(I)> make_pow_table(std::index_sequence<I...>) noexcept {
+        return {{&pow<static_cast<int>(I), T>...}};
+    }
+    template<class T>
+    inline constexpr auto pow_table = make_pow_table<T>(std::make_index_sequence<POW_STDPOW_CUTOFF + 1>{});
+
     template<class T>
     inline T pow_small_int(T x, int n) noexcept {
         // n assumed small magnitude here
-        if (n == 0) return T{1};
-        bool neg = (n < 0);
-        unsigned uu = static_cast<unsigned>(neg ? -static_cast<long long>(n) : n);
-        T res = T{1};
-        while (uu) {
-            if (uu & 1u) res *= x;
-            x *= x;
-            uu >>= 1u;
+        return (n < 0) ? T{1} / pow_table<T>[-n](x) : pow_table<T>[n](x);
+    }
+
+    // Array loops with the exponent fixed at compile time, so that they vectorize
+    template<int N, class T>
+    void pow_loop(const T* x, T* out, std::size_t n) noexcept {
+        for (std::size_t i = 0; i < n; ++i) {
+            if constexpr (N < 0) {
+                out[i] = T{1} / pow<-N>(x[i]);
+            } else {
+                out[i] = pow<N>(x[i]);
+            }
         }
-        return neg ? T{1} / res : res;
     }
+    template<class T, std::size_t... I>
+    constexpr std::array<void (*)(const T*, T*, std::size_t) noexcept, sizeof...(I)> make_pow_loop_table(std::index_sequence<I...>) noexcept {
+        return {{&pow_loop<static_cast<int>(I) - POW_STDPOW_CUTOFF, T>...}};
+    }
+    template<class T>
+    inline constexpr auto pow_loop_table = make_pow_loop_table<T>(std::make_index_sequence<2 * POW_STDPOW_CUTOFF + 1>{});
 }
 
 template<class T>
 inline T pow(T x, int n) noexcept {
     if constexpr (std::is_floating_point_v<T>) {
-        // For small |n|, manual binary exponentiation beats std::pow
+        // For small |n|, the unrolled pow<N> beats std::pow
         if (n >= -POW_STDPOW_CUTOFF && n <= POW_STDPOW_CUTOFF) {
             return detail::pow_small_int(x, n);
         }
@@ -105,5 +169,30 @@ inline T pow(T x, int n) noexcept {
     }
 }
 
+//---------------------------------------------
+// 4) Array form: out[i] = x[i]^n for a runtime n shared by all elements.
+//    The exponent is dispatched once, to a loop over the unrolled pow<N>.
+//---------------------------------------------
+template<class T>
+inline std::enable_if_t<std::is_floating_point_v<T>>
+pow(const T* x, T* out, std::size_t size, int n) noexcept {
+    if (n >= -POW_STDPOW_CUTOFF && n <= POW_STDPOW_CUTOFF) {
+        detail::pow_loop_table<T>[n + POW_STDPOW_CUTOFF](x, out, size);
+        return;
+    }
+    for (std::size_t i = 0; i < size; ++i) {
+        out[i] = pow(x[i], n);
+    }
+}
+
+#ifdef BEAVER_HAS_SPAN
+template<class T>
+inline std::enable_if_t<std::is_floating_point_v<T>>
+pow(std::span<const T> x, int n, std::span<T> out) noexcept {
+    assert(out.size() >= x.size());
+    pow(x.data(), out.data(), x.size(), n);
+}
+#endif
+
 } // namespace beaver
 #endif
\ No newline at end of file
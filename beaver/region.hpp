@@ -0,0 +1,22 @@
+#ifndef BEAVER_REGION_HPP
+#define BEAVER_REGION_HPP
+
+// Region tags for the pre-validated entry points, e.g. beaver::dilog(x, beaver::region::unit_interval).
+// The caller asserts that x is finite and lies in the region noted next to each tag, end points
+// included where marked <=; debug builds check this with assert. No argument validation is done and
+// the call goes straight to the kernel of that region, the same one the checked function uses there.
+namespace beaver::region {
+  struct below_minus_one_t { explicit constexpr below_minus_one_t() = default; }; // x<-1
+  struct negative_unit_t   { explicit constexpr negative_unit_t()   = default; }; // -1<=x<=0
+  struct lower_half_t      { explicit constexpr lower_half_t()      = default; }; // 0<=x<=1/2
+  struct upper_half_t      { explicit constexpr upper_half_t()      = default; }; // 1/2<x<1
+  struct unit_interval_t   { explicit constexpr unit_interval_t()   = default; }; // 0<x<1
+
+  inline constexpr below_minus_one_t below_minus_one{};
+  inline constexpr negative_unit_t   negative_unit{};
+  inline constexpr lower_half_t      lower_half{};
+  inline constexpr upper_half_t      upper_half{};
+  inline constexpr unit_interval_t   unit_interval{};
+}
+
+#endif // BEAVER_REGION_HPP
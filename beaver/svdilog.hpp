@@ -1,17 +1,21 @@
 #ifndef BEAVER_SVDILOG_HPP
 #define BEAVER_SVDILOG_HPP
 #include "log.hpp"
+#include "clog.hpp"
+#include "dilog.hpp"
+#include "clausen.hpp"
 #include "config.hpp"
+#include "region.hpp"
 #include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <utility>
 
 namespace beaver {
-    BEAVER_NODISCARD inline double  svdilog(double x) noexcept {
-
-  //Catch non-finite input
-  if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
+  namespace internals::svdilog{
   //universal constants
   const double zeta2=1.6449340668482264365;
-  const double ln2=0.69314718055994530942;
   //MiniMax numerator coefficients of log(1-x)/x
   const double P1[]={-0.9999999999999998672,
                             2.7601168443679114661,
@@ -42,6 +46,114 @@ namespace beaver {
                      0.41598884303385830899,
                      -0.039805247256814134496,
                       0.00082755014107320442259}; 
+  //svp(2,x)=c+s*(Li2(y)+1/2*log(y)*log(1-y)) for the mapped argument 0<y<=0.5
+  inline double kernel(double y, double c, double s) noexcept {
+  BEAVER_ASSUME(y > 0.0);
+  const double y2=y*y;
+  const double y4=y2*y2;
+  const double tinyswitch=1e-4;//switch up to which an expansion about y=0 is used. Guarantees precission for small y.
+    if(y<tinyswitch) {
+        const double l=beaver::log(y);//Fast implementation of log(y) that is stable near 0
+        //C= y+1/4*y^2+1/9*y^3+1/16*y^4 (non-log part from Li2)
+        const double C=y+std::fma(1.0/9.0,y,0.25)*y2+1.0/16.0*y4;//polynomial part of small y expansion
+        // D = -1/2*y - 1/4*y^2 - 1/6*y^3 - 1/8*y^4 (log part from log(1-x))
+        const double D = -0.5*y + std::fma(-1.0/6.0, y, -0.25)*y2 - 0.125*y4;
+        return c + s*std::fma(l,D,C); // small y expression including mapping constants and signs
+    }
+    else {
+        //log(1-x)/x MiniMax numerator polynomial in Estrin scheme
+        const double p1=std::fma(P1[1],y,P1[0])+y2*std::fma(P1[3],y,P1[2])+y4*std::fma(P1[5],y,P1[4]);
+
+        //log(1-x)/x MiniMax denominator polynomial in Estrin scheme
+        const double q1_t0=std::fma(Q1[1],y,Q1[0]);
+        const double q1_t2=std::fma(Q1[3],y,Q1[2]);
+        const double q1_t4=std::fma(Q1[5],y,Q1[4]);
+        const double q1=q1_t0 + y2*q1_t2 + y4*std::fma(Q1[6], y2, q1_t4);
+
+        //Li2(x)/x MiniMax numerator polynomial in Estrin scheme
+        const double p2=std::fma(P2[1],y,P2[0])+y2*std::fma(P2[3],y,P2[2])+y4*std::fma(P2[5],y,P2[4]);
+
+        //Li2(x)/x MiniMax denominator polynomial in Estrin scheme
+        const double q2_t0=std::fma(Q2[1],y,Q2[0]);
+        const double q2_t2=std::fma(Q2[3],y,Q2[2]);
+        const double q2_t4=std::fma(Q2[5],y,Q2[4]);
+        const double q2=q2_t0 + y2*q2_t2 + y4*std::fma(Q2[6], y2, q2_t4);
+
+        //Denominator for log(1-x)/x
+        const double denomq1half=1.0/(2.0*q1);
+        //Denominator for Li2(x)/x
+        const double denomq2=1.0/q2;
+        //const double denomql=1.0/ql;
+        //Final result for svp(2,x)=Li2(y)+1/2*log(y)*log(1-y) (argument is apped to fall in 0<y<=0.5)
+        return std::fma(s*y*p1*denomq1half,beaver::log(y),std::fma(s*denomq2,y*p2,c));
+    }
+  }
+    //complex argument: |Im z|<strip*min(|x|,|1-x|) takes the real part from the real kernels (plus the
+    //first-order term on the cut), O((Im z)^2) corrections are below rounding there
+  const double strip=1e-8;
+    //Cl2(2 theta) for theta=atan2(y,w), y>0. Near theta=pi/2 the distance s=pi-2 theta=2 atan2(|w|,y)
+    //is formed from y and w directly, and 2 theta>pi folds back through Cl2(2pi-t)=-Cl2(t)
+  inline double cl2_double_angle(double y, double w) noexcept {
+    namespace  CL=internals::clausen;
+    namespace  C=internals::clog;
+    const double sqrt3=1.7320508075688772935;
+    const double aw=std::fabs(w);
+    const double c=(aw*sqrt3>y) ? CL::cl2_zero(2.0*C::atan2(y,aw)) : CL::cl2_pi(2.0*C::atan2(aw,y));
+    return std::copysign(c,w);
+  }
+    //Bloch-Wigner D(z) by Kummer's formula D=1/2(Cl2(2a)+Cl2(2b)+Cl2(2c)), a,b,c the angles of the
+    //triangle (0,1,z), each one an atan2 of the cross and dot products at its vertex. If the largest
+    //angle exceeds 2pi/3, Cl2 of it is -Cl2(2a+2b) with a,b the two smaller angles, and the t(1-log t)
+    //parts of the three Clausen terms are combined analytically, so D~Im z keeps its relative accuracy
+    //near the real axis.
+  inline double bloch_wigner(double rz, double iz) noexcept {
+    namespace  CL=internals::clausen;
+    namespace  C=internals::clog;
+    const double y=std::fabs(iz);
+    const double wa=rz;//angle at 0
+    const double wb=1.0-rz;//angle at 1
+    const double wc=std::fma(rz,rz-1.0,y*y);//angle at z, directly (pi-a-b would cancel)
+    double a=C::atan2(y,wa);
+    double b=C::atan2(y,wb);
+    double c=C::atan2(y,wc);
+    if(a>c) std::swap(a,c);
+    if(b>c) std::swap(b,c);
+    if(a>b) std::swap(a,b);
+    const double t1=2.0*a;
+    const double t2=2.0*b;
+    const double t3=t1+t2;
+    double d;
+    if(t3<CL::split){
+      //t1 log(t3/t1)+t2 log(t3/t2)+cubic remainders g(t)=t^3 r(t^2); the linear parts cancel exactly.
+      //g(t3)-g(t2)=(t3^3-t2^3) r(u3)+t2^3 (r(u3)-r(u2)) is O(t1) term by term, which keeps D accurate
+      //when the smallest angle t1 is tiny (z next to 0 or 1)
+      const double u1=t1*t1;
+      const double u2=t2*t2;
+      const double u3=t3*t3;
+      const double l1=(t1>0) ? t1*beaver::log1p(t2/t1) : 0.0;
+      const double l2=t2*beaver::log1p(t1/t2);
+      const double g3mg2=t1*(std::fma(t3,t3+t2,u2)*CL::small_ratio(u3)+t2*u2*(t3+t2)*CL::ratio_slope(CL::PA,CL::QA,u2,u3));
+      d=l1+l2+(t1*u1*CL::small_ratio(u1)-g3mg2);
+    }else if(t1<0.25){
+      //smallest angle tiny with the other two in (pi/3,2pi/3) (z next to 0 or 1, or far out):
+      //Cl2(t2)-Cl2(t2+t1) would cancel, take it as a difference of the kernel
+      d=((t1>0) ? CL::cl2_zero(t1) : 0.0)-CL::cl2_step(t2,t1);
+    }else{
+      d=cl2_double_angle(y,wa)+cl2_double_angle(y,wb)+cl2_double_angle(y,wc);
+    }
+    return std::copysign(0.5*d,iz);
+  }
+    //d=Im Li2(z)+arg(1-z)log|z| as assembled by the branches of the complex svdilog, terms the sum of the
+    //moduli that went into it: keep d while the parts cancel by less than a factor 4, else Kummer's formula
+  inline double bloch_wigner(double rz, double iz, double d, double terms) noexcept {
+    return (terms<=4.0*std::fabs(d)) ? d : bloch_wigner(rz,iz);
+  }
+  }
+    BEAVER_NODISCARD inline double  svdilog(double x) noexcept {
+  namespace  LOC=internals::svdilog;
+  //Catch non-finite input
+  if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
+  const double zeta2=LOC::zeta2;
   //Define arguments of SVPs and constants in the mapping formula. Argument always land in (0,0.5).
   double y=0; 
   double c=0; 
@@ -75,45 +187,167 @@ namespace beaver {
         c=2.0*zeta2; //Constant in mapping
         s=-1; //Signum in mapping
     }
-  const double y2=y*y;
-  const double y4=y2*y2;
-  const double tinyswitch=1e-4;//switch up to which an expansion about y=0 is used. Guarantees precission for small y.
-    if(y<tinyswitch) {
-        const double l=beaver::log(y);//Fast implementation of log(y) that is stable near 0
-        //C= y+1/4*y^2+1/9*y^3+1/16*y^4 (non-log part from Li2)
-        const double C=y+std::fma(1.0/9.0,y,0.25)*y2+1.0/16.0*y4;//polynomial part of small y expansion
-        // D = -1/2*y - 1/4*y^2 - 1/6*y^3 - 1/8*y^4 (log part from log(1-x))
-        const double D = -0.5*y + std::fma(-1.0/6.0, y, -0.25)*y2 - 0.125*y4;
-        return c + s*std::fma(l,D,C); // small y expression including mapping constants and signs
+  return LOC::kernel(y,c,s);
     }
-    else {
-        //log(1-x)/x MiniMax numerator polynomial in Estrin scheme
-        const double p1=std::fma(P1[1],y,P1[0])+y2*std::fma(P1[3],y,P1[2])+y4*std::fma(P1[5],y,P1[4]);
 
-        //log(1-x)/x MiniMax denominator polynomial in Estrin scheme
-        const double q1_t0=std::fma(Q1[1],y,Q1[0]);
-        const double q1_t2=std::fma(Q1[3],y,Q1[2]);
-        const double q1_t4=std::fma(Q1[5],y,Q1[4]);
-        const double q1=q1_t0 + y2*q1_t2 + y4*std::fma(Q1[6], y2, q1_t4);
+  // ----------- batch version over arrays -----------
+  inline void svdilog(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=svdilog(x[i]);
+    }
+  }
 
-        //Li2(x)/x MiniMax numerator polynomial in Estrin scheme
-        const double p2=std::fma(P2[1],y,P2[0])+y2*std::fma(P2[3],y,P2[2])+y4*std::fma(P2[5],y,P2[4]);
+/**
+ * @brief function for the fast computation of the single-valued dilogarithm at complementary argument
+ * @param y: real argument, y=1-x
+ * @return \f$\mathcal{L}_2(1-y)\f$, with the mapped kernel argument formed from y directly
+ */
+  BEAVER_NODISCARD inline double  svdilog_1m(double y) noexcept {
+  namespace  LOC=internals::svdilog;
+  //Catch non-finite input
+  if (!std::isfinite(y)) return std::numeric_limits<double>::quiet_NaN();
+  const double zeta2=LOC::zeta2;
+    if(y <= -1.0){//x>=2
+        return LOC::kernel(1/(1-y),2.0*zeta2,-1);
+    } else if(y < 0.0){//1<x<2
+        return LOC::kernel(-y/(1-y),zeta2,1);
+    } else if(y==0.0){
+        return zeta2;
+    } else if(y < 0.5){//0.5<x<1
+        return LOC::kernel(y,zeta2,-1);
+    } else if(y < 1.0){//0<x<=0.5, 1-y exact
+        return LOC::kernel(1-y,0,1);
+    } else if(y==1.0){
+        return 0.0;
+    } else if(y <= 2.0){//-1<=x<0
+        return LOC::kernel((y-1)/y,0,-1);
+    }
+    //x<-1
+    return LOC::kernel(1/y,-zeta2,1);
+    }
+  inline void svdilog_1m(const double* y, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=svdilog_1m(y[i]);
+    }
+  }
 
-        //Li2(x)/x MiniMax denominator polynomial in Estrin scheme
-        const double q2_t0=std::fma(Q2[1],y,Q2[0]);
-        const double q2_t2=std::fma(Q2[3],y,Q2[2]);
-        const double q2_t4=std::fma(Q2[5],y,Q2[4]);
-        const double q2=q2_t0 + y2*q2_t2 + y4*std::fma(Q2[6], y2, q2_t4);
+  // ----------- region-tagged entry points: no validation, caller asserts finite x in the region -----------
+  BEAVER_NODISCARD inline double  svdilog(double x, region::below_minus_one_t) noexcept {
+    BEAVER_ASSUME(x < -1.0);
+    return internals::svdilog::kernel(1/(1-x),-internals::svdilog::zeta2,1);
+  }
+  BEAVER_NODISCARD inline double  svdilog(double x, region::negative_unit_t) noexcept {
+    BEAVER_ASSUME(x >= -1.0 && x <= 0.0);
+    //L2(0)=0 as in the checked function, the kernel itself takes log(x)
+    return (x<0.0) ? internals::svdilog::kernel(x/(x-1),0,-1) : 0.0;
+  }
+  BEAVER_NODISCARD inline double  svdilog(double x, region::lower_half_t) noexcept {
+    BEAVER_ASSUME(x >= 0.0 && x <= 0.5);
+    return (x>0.0) ? internals::svdilog::kernel(x,0,1) : 0.0;
+  }
+  BEAVER_NODISCARD inline double  svdilog(double x, region::upper_half_t) noexcept {
+    BEAVER_ASSUME(x > 0.5 && x < 1.0);
+    return internals::svdilog::kernel(1-x,internals::svdilog::zeta2,-1);
+  }
+  BEAVER_NODISCARD inline double  svdilog(double x, region::unit_interval_t) noexcept {
+    BEAVER_ASSUME(x > 0.0 && x < 1.0);
+    const bool lower=(x<=0.5);
+    return internals::svdilog::kernel(lower ? x : 1-x, lower ? 0 : internals::svdilog::zeta2, lower ? 1 : -1);
+  }
+  template<class Region>
+  inline void svdilog(const double* x, double* out, std::size_t n, Region r) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=svdilog(x[i],r);
+    }
+  }
 
-        //Denominator for log(1-x)/x
-        const double denomq1half=1.0/(2.0*q1);
-        //Denominator for Li2(x)/x
-        const double denomq2=1.0/q2;
-        //const double denomql=1.0/ql;
-        //Final result for svp(2,x)=Li2(y)+1/2*log(y)*log(1-y) (argument is apped to fall in 0<y<=0.5)
-        return std::fma(s*y*p1*denomq1half,beaver::log(y),std::fma(s*denomq2,y*p2,c));
+  namespace unchecked {
+    //svdilog without argument checks, caller guarantees finite x, x!=0 and x!=1
+  BEAVER_NODISCARD inline double  svdilog(double x) noexcept {
+    namespace  LOC=internals::svdilog;
+    BEAVER_ASSUME(x != 0.0 && x != 1.0);
+    if(x < -1.0) return LOC::kernel(1/(1-x),-LOC::zeta2,1);
+    if(x < 0.0)  return LOC::kernel(x/(x-1),0,-1);
+    if(x <= 0.5) return LOC::kernel(x,0,1);
+    if(x < 1.0)  return LOC::kernel(1-x,LOC::zeta2,-1);
+    if(x < 2.0)  return LOC::kernel(1-1/x,LOC::zeta2,1);
+    return LOC::kernel(1/x,2.0*LOC::zeta2,-1);
+  }
+  inline void svdilog(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=svdilog(x[i]);
+    }
+  }
+  }
+
+/**
+ * @brief function for the fast computation of the single-valued dilogarithm at complex argument
+ * @param z: complex argument
+ * @return real part \f$\mathrm{Re}\,\mathrm{Li}_2(z)+\frac12\log|z|\log|1-z|\f$ (equals svdilog(x) on the real axis),
+ *         imaginary part the Bloch-Wigner function \f$D(z)=\mathrm{Im}\,\mathrm{Li}_2(z)+\arg(1-z)\log|z|\f$.
+ *         svdilog(conj(z))=conj(svdilog(z)), so the zbar partner of a (z,zbar) pair costs nothing extra.
+ */
+  BEAVER_NODISCARD inline std::complex<double>  svdilog(std::complex<double> z) noexcept {
+    namespace  LOC=internals::dilog;
+    namespace  C=internals::clog;
+    const double rz=z.real();
+    const double iz=z.imag();
+    //Catch non-finite input
+    if (!std::isfinite(rz) || !std::isfinite(iz)){
+      const double nan=std::numeric_limits<double>::quiet_NaN();
+      return {nan,nan};
+    }
+    //real axis: real MiniMax kernels, D vanishes
+    if(iz==0){
+      return {beaver::svdilog(rz), 0.0};
     }
+    //strip along the real axis: Re L2(x+iy)=L2(x)+O(y^2) from the real MiniMax kernels,
+    //on the cut x>1 Re Li2 picks up -pi|y|/x
+    if(std::fabs(iz)<internals::svdilog::strip*std::fmin(std::fabs(rz),std::fabs(1.0-rz))){
+      const double re=beaver::svdilog(rz);
+      return {(rz>1)?std::fma(-C::pi*std::fabs(iz),1.0/rz,re):re, internals::svdilog::bloch_wigner(rz,iz)};
+    }
+    const double nz=rz*rz+iz*iz;
+    //unit circle: log|z|=0, Re L2(e^{it})=Re Li2(e^{it}) in closed form
+    if(nz==1){
+      return {beaver::li2_unit_circle(C::atan2(iz,rz)).real(), internals::svdilog::bloch_wigner(rz,iz)};
+    }
+    if(rz<=0.5 && nz<=1){
+      //log(1-z) is both the Bernoulli variable and part of the combination
+      const std::complex<double> l1mz=C::log1p(-z);
+      const double lnz=C::log_abs(rz,iz);
+      const std::complex<double> li2=LOC::Li2_Bernoulli(-l1mz);
+      const double al=lnz*l1mz.imag();
+      const double im=internals::svdilog::bloch_wigner(rz,iz,al+li2.imag(),std::fabs(al)+std::fabs(li2.real())+std::fabs(li2.imag()));
+      return {std::fma(0.5*lnz,l1mz.real(),li2.real()), im};
+    }
+    if(nz<=2*rz){
+      //|1-z|<=1: Li2(z)=-Li2(1-z)+zeta2-log(z)log(1-z); in D the log|z| arg(1-z) pieces cancel analytically
+      const std::complex<double> l1mz=C::log1p(-z);
+      const std::complex<double> lz=C::log1p({rz-1.0,iz});
+      const std::complex<double> li2b=LOC::Li2_Bernoulli(-lz);
+      const std::complex<double> li2=-li2b+LOC::zeta2-C::mul(lz,l1mz);
+      const double al=lz.imag()*l1mz.real();
+      const double im=internals::svdilog::bloch_wigner(rz,iz,-li2b.imag()-al,std::fabs(al)+std::fabs(li2b.real())+std::fabs(li2b.imag()));
+      return {std::fma(0.5*lz.real(),l1mz.real(),li2.real()), im};
+    }
+    //|z|>1, w=1/z: L2 real part -> -Re L2(w)-zeta2+1/2 arg^2(-z), D(z)=-D(w).
+    //Written in w directly, the log^2|z| pieces cancel analytically instead of numerically.
+    const std::complex<double> l1mw=C::log1p(-C::inv(z));
+    const double lnz=C::log_abs(rz,iz);
+    const double pmz=C::atan2(-iz,-rz);
+    const std::complex<double> li2w=LOC::Li2_Bernoulli(-l1mw);
+    const double al=lnz*l1mw.imag();
+    const double im=internals::svdilog::bloch_wigner(rz,iz,al-li2w.imag(),std::fabs(al)+std::fabs(li2w.real())+std::fabs(li2w.imag()));
+    return {std::fma(0.5*lnz,l1mw.real(),std::fma(0.5*pmz,pmz,-LOC::zeta2)-li2w.real()), im};
+  }
+
+  // ----------- batch version over arrays of complex arguments -----------
+  inline void svdilog(const std::complex<double>* z, std::complex<double>* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=svdilog(z[i]);
     }
+  }
 
 }
-#endif
\ No newline at end of file
+#endif
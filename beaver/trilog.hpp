@@ -1,8 +1,12 @@
 #ifndef BEAVER_TRILOG_HPP
 #define BEAVER_TRILOG_HPP
 #include "log.hpp"
+#include "clog.hpp"
 #include "config.hpp"
+#include "region.hpp"
 #include <cmath>
+#include <complex>
+#include <cstddef>
 
 namespace beaver {
     namespace internals::trilog{
@@ -10,6 +14,10 @@ namespace beaver {
   const double ln2=0.69314718055994530942;
   const double zeta2=1.6449340668482264365;
   const double zeta3=1.2020569031595942854;
+    //switch up to which an expansion about x=0 or x=1 is used. Guarantees precision for small y.
+  const double taylorswitch=1e-4;
+    //complex argument: |Im z|<strip*min(|x|,|1-x|) uses the first-order expansion about the real axis
+  const double strip=1e-8;
   //MiniMax numerator coefficients of log(1-x)/x
   const double P1[]={-0.9999999999999998672,2.7601168443679114620,-2.7923621883637091036,1.2497503713725827027,-0.23173044836039025061,0.012188323559602391476};
     //MiniMax denominator coefficients of log(1-x)/x
@@ -26,6 +34,10 @@ namespace beaver {
   const double P3c[]={0.0000000000000000000,0.74999999999999999816,-2.1777582585501254342,2.2971231247321237024,-1.0455892723397490220,0.18551293485607298693,-0.0087864196233895762452};        
   //MiniMax denominator coefficients of (-Li3(x/(x-1))-Li3(x))/x on 10^(-4)<x<0.5
   const double Q3c[]={1.0000000000000000000,-3.9036776780668347591,6.0266936962282502098,-4.6317082415371928343,1.8223918699839630482,-0.33647047688023663835,0.023067775463027464700,-0.00028585989330444185814}; 
+    //Taylor coefficients u^1..u^22 of Li3(1-exp(-u)) (|z|<=1 away from z=1, |u|<1.1)
+  const double U3[]={1.0,-0.375,0.078703703703703703704,-0.0086805555555555555556,0.00012962962962962962963,0.000081018518518518518519,-3.4193571608537594932e-6,-1.3286564625850340136e-6,8.6608717561098513479e-8,2.5260875955320399765e-8,-2.1446944683640647609e-9,-5.1401106220129789153e-10,5.2495821146008294364e-11,1.0887754406636318375e-11,-1.2779396094493695306e-12,-2.36982417730874521e-13,3.1043578879654622943e-14,5.2617586299125060841e-15,-7.538479549949265366e-16,-1.1862322577752285253e-16,1.8316979965491383382e-17,2.7068171031837350151e-18};
+    //coefficients zeta(3-k)/k!, k=6,8,..,18, of Li3(exp(v)) around v=0 (|v|<1)
+  const double V3[]={0.000011574074074074074074,-9.8418997228521038045e-8,1.1482216343327454439e-9,-1.5815724990809165893e-11,2.4195009792525151945e-13,-3.9828977769894877479e-15,6.9233666183059290581e-17};
     }
   //Li3 kernel around x=0
   static double Li3_Taylor(double x){
@@ -33,75 +45,102 @@ namespace beaver {
         double x4=x2*x2;
         return x+(1.0/8+1.0/27*x)*x2+1.0/64*x4;
     }
-    BEAVER_NODISCARD inline double  trilog(double x) noexcept {
-    namespace  LOC=internals::trilog;
-    double taylorswitch=1e-4;//switch up to which an expansion about x=0 or x=1 is used. Guarantees precission for small y.
-    double invtaylorswitch=1/taylorswitch;
-  //Catch non-finite input
-  if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
-  if(x<-invtaylorswitch){
-    double l=beaver::log(-x);
-    double l3=l*l*l;
-    double c=-l*LOC::zeta2-1.0/6*l3;
-    double xinv=1.0/x;
-    double li3inv=Li3_Taylor(xinv);
-    return li3inv+c;
-  }else if(x<-1){
-    double l=beaver::log(-x);
-    double l3=l*l*l;
-    double c=-l*LOC::zeta2-1.0/6*l3;
-    double x2=x*x;
-    double x4=x2*x2;
-    double x6=x4*x2;
-    double p=LOC::P3b[5]+x*LOC::P3b[4]+x2*(LOC::P3b[3]+x*LOC::P3b[2])+x4*(LOC::P3b[1]+x*LOC::P3b[0]);
-    double q=LOC::Q3b[6]+x*LOC::Q3b[5]+x2*(LOC::Q3b[4]+x*LOC::Q3b[3])+x4*(LOC::Q3b[2]+x*LOC::Q3b[1])+x6*LOC::Q3b[0];
-    return p/q+c;
-  }else if(x==-1){
-    return -0.75*LOC::zeta3;
-  }else if(x<-taylorswitch){
+  namespace internals::trilog{
+    //Li3 on -1<=x<=0: (6,6) MiniMax
+  inline double negative_unit(double x) noexcept{
     double x2=x*x;
     double x4=x2*x2;
     double x6=x4*x2;
-    double p=x*LOC::P3b[0]+x2*(LOC::P3b[1]+x*LOC::P3b[2])+x4*(LOC::P3b[3]+x*LOC::P3b[4])+x6*LOC::P3b[5];
-    double q=LOC::Q3b[0]+x*LOC::Q3b[1]+x2*(LOC::Q3b[2]+x*LOC::Q3b[3])+x4*(LOC::Q3b[4]+x*LOC::Q3b[5])+x6*LOC::Q3b[6];
+    double p=x*P3b[0]+x2*(P3b[1]+x*P3b[2])+x4*(P3b[3]+x*P3b[4])+x6*P3b[5];
+    double q=Q3b[0]+x*Q3b[1]+x2*(Q3b[2]+x*Q3b[3])+x4*(Q3b[4]+x*Q3b[5])+x6*Q3b[6];
     return p/q;
-  }else if(x<taylorswitch){
-    return Li3_Taylor(x);
-  }else if(x<0.5){
+  }
+    //Li3 on 0<=x<=0.5: (6,6) MiniMax
+  inline double lower_half(double x) noexcept{
     double x2=x*x;
     double x4=x2*x2;
     double x6=x4*x2;
-    double p=x*LOC::P3a[0]+x2*(LOC::P3a[1]+x*LOC::P3a[2])+x4*(LOC::P3a[3]+x*LOC::P3a[4])+x6*LOC::P3a[5];
-    double q=LOC::Q3a[0]+x*LOC::Q3a[1]+x2*(LOC::Q3a[2]+x*LOC::Q3a[3])+x4*(LOC::Q3a[4]+x*LOC::Q3a[5])+x6*LOC::Q3a[6];
+    double p=x*P3a[0]+x2*(P3a[1]+x*P3a[2])+x4*(P3a[3]+x*P3a[4])+x6*P3a[5];
+    double q=Q3a[0]+x*Q3a[1]+x2*(Q3a[2]+x*Q3a[3])+x4*(Q3a[4]+x*Q3a[5])+x6*Q3a[6];
     return p/q;
-  }else if(x==0.5)
-  {
-    return 21.0/24*LOC::zeta3+1.0/6*LOC::ln2*LOC::ln2*LOC::ln2-0.5*LOC::zeta2*LOC::ln2;
-  }else if(x<1-taylorswitch){
-    double y=1-x;
+  }
+    //Li3(1-y) on 0<y<=0.5 via the (6,7) MiniMax of -Li3(x/(x-1))-Li3(x)
+  inline double reflected(double y) noexcept{
+    BEAVER_ASSUME(y > 0.0);
     double y2=y*y;
     double y4=y2*y2;
     double y6=y2*y4;
     double ly=beaver::log(y);
     //calculate l=log(x) with MiniMax (argument is guaranteed to be between 0.5 and 1)
     //double l=beaver::log(x); //is slower
-    double pl=y*LOC::P1[0]+y2*std::fma(LOC::P1[2],y,LOC::P1[1])+y4*std::fma(LOC::P1[4],y,LOC::P1[3])+y6*LOC::P1[5];
-    double ql=LOC::Q1[0]+y*LOC::Q1[1]+y2*std::fma(LOC::Q1[3],y,LOC::Q1[2])+y4*std::fma(LOC::Q1[5],y,LOC::Q1[4])+y6*LOC::Q1[6];
+    double pl=y*P1[0]+y2*std::fma(P1[2],y,P1[1])+y4*std::fma(P1[4],y,P1[3])+y6*P1[5];
+    double ql=Q1[0]+y*Q1[1]+y2*std::fma(Q1[3],y,Q1[2])+y4*std::fma(Q1[5],y,Q1[4])+y6*Q1[6];
     double l=pl/ql;
     double l2=l*l;
     double l3=l2*l;
-    double c=LOC::zeta3+l*LOC::zeta2-1.0/2*l2*ly+1.0/6*l3;
-    double p=y2*(LOC::P3c[1]+y*LOC::P3c[2])+y4*(LOC::P3c[3]+y*LOC::P3c[4])+y6*(LOC::P3c[5]+y*LOC::P3c[6]);
-    double q=LOC::Q3c[0]+y*LOC::Q3c[1]+y2*(LOC::Q3c[2]+y*LOC::Q3c[3])+y4*(LOC::Q3c[4]+y*LOC::Q3c[5])+y6*(LOC::Q3c[6]+y*LOC::Q3c[7]);
+    double c=zeta3+l*zeta2-1.0/2*l2*ly+1.0/6*l3;
+    double p=y2*(P3c[1]+y*P3c[2])+y4*(P3c[3]+y*P3c[4])+y6*(P3c[5]+y*P3c[6]);
+    double q=Q3c[0]+y*Q3c[1]+y2*(Q3c[2]+y*Q3c[3])+y4*(Q3c[4]+y*Q3c[5])+y6*(Q3c[6]+y*Q3c[7]);
     return p/q+c;
-  } else if(x<1){
-    double y=1-x;
+  }
+    //Li3(1-y) for 0<y<10^(-4): expansion about x=1
+  inline double near_one(double y) noexcept{
     double y2=y*y;
     double y4=y2*y2;
     double ly=beaver::log(y);
-    double taylor=LOC::zeta3-y*LOC::zeta2+y2*(0.75-LOC::zeta2/2+y*(7.0/12-1.0/3*LOC::zeta2))+y4*(131.0/288-1.0/4*LOC::zeta2);
+    double taylor=zeta3-y*zeta2+y2*(0.75-zeta2/2+y*(7.0/12-1.0/3*zeta2))+y4*(131.0/288-1.0/4*zeta2);
     double logtaylor=y2*(-0.5-0.5*y)-11.0/24*y4;
     return taylor+ly*logtaylor;
+  }
+    //Li3 on x<-1: Li3(1/x)-zeta2 log(-x)-1/6 log^3(-x), Taylor in 1/x for x<-1/taylorswitch, else the
+    //MiniMax of -1<=x<=0 with reversed coefficients, i.e. evaluated at 1/x without the division
+  inline double on_below_minus_one(double x) noexcept{
+    double l=beaver::log(-x);
+    double l3=l*l*l;
+    double c=-l*zeta2-1.0/6*l3;
+    if(x<-1/taylorswitch){
+      return Li3_Taylor(1.0/x)+c;
+    }
+    double x2=x*x;
+    double x4=x2*x2;
+    double x6=x4*x2;
+    double p=P3b[5]+x*P3b[4]+x2*(P3b[3]+x*P3b[2])+x4*(P3b[1]+x*P3b[0]);
+    double q=Q3b[6]+x*Q3b[5]+x2*(Q3b[4]+x*Q3b[3])+x4*(Q3b[2]+x*Q3b[1])+x6*Q3b[0];
+    return p/q+c;
+  }
+    //Li3 on -1<=x<=0
+  inline double on_negative_unit(double x) noexcept{
+    if(x==-1){
+      return -0.75*zeta3;
+    }
+    return (x<-taylorswitch) ? negative_unit(x) : Li3_Taylor(x);
+  }
+    //Li3 on 0<=x<=0.5
+  inline double on_lower_half(double x) noexcept{
+    if(x<taylorswitch){
+      return Li3_Taylor(x);
+    }
+    return (x<0.5) ? lower_half(x) : 21.0/24*zeta3+1.0/6*ln2*ln2*ln2-0.5*zeta2*ln2;
+  }
+    //Li3 on 0.5<x<1
+  inline double on_upper_half(double x) noexcept{
+    return (x<1-taylorswitch) ? reflected(1-x) : near_one(1-x);
+  }
+  }
+    //Li3 for real x<=1: dispatches to the same on_<region> kernels as the trilog(x,region) overloads
+    //and unchecked::trilog below, only adding the non-finite, x==1 and branch-cut cases.
+    BEAVER_NODISCARD inline double  trilog(double x) noexcept {
+    namespace  LOC=internals::trilog;
+  //Catch non-finite input
+  if (!std::isfinite(x)) return std::numeric_limits<double>::quiet_NaN();
+  if(x<-1){
+    return LOC::on_below_minus_one(x);
+  }else if(x<=0){
+    return LOC::on_negative_unit(x);
+  }else if(x<=0.5){
+    return LOC::on_lower_half(x);
+  }else if(x<1){
+    return LOC::on_upper_half(x);
   }else if(x==1){
     return LOC::zeta3;
   }else{//Argument on branch-cut
@@ -109,5 +148,154 @@ namespace beaver {
   }
 }
 
+  // ----------- batch version over arrays -----------
+  inline void trilog(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=trilog(x[i]);
+    }
+  }
+
+/**
+ * @brief function for the fast computation of the trilogarithm at complementary argument
+ * @param y: real argument, y=1-x
+ * @return \f$\mathrm{Li}_3(1-y)\f$, without rounding 1-y near x=1
+ */
+  BEAVER_NODISCARD inline double  trilog_1m(double y) noexcept {
+    namespace  LOC=internals::trilog;
+  //Catch non-finite input
+  if (!std::isfinite(y)) return std::numeric_limits<double>::quiet_NaN();
+  if(y<0){//Argument on branch-cut
+    return std::numeric_limits<double>::quiet_NaN();
+  }else if(y==0){
+    return LOC::zeta3;
+  }else if(y<LOC::taylorswitch){
+    return LOC::near_one(y);
+  }else if(y<0.5){
+    return LOC::reflected(y);
+  }
+  //x=1-y<=0.5 is exact for y<=2, beyond that x carries the full relative precision of y
+  return trilog(1-y);
+}
+  inline void trilog_1m(const double* y, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=trilog_1m(y[i]);
+    }
+  }
+
+  // ----------- region-tagged entry points: no validation, caller asserts finite x in the region -----------
+  BEAVER_NODISCARD inline double  trilog(double x, region::below_minus_one_t) noexcept {
+    BEAVER_ASSUME(x < -1.0);
+    return internals::trilog::on_below_minus_one(x);
+  }
+  BEAVER_NODISCARD inline double  trilog(double x, region::negative_unit_t) noexcept {
+    BEAVER_ASSUME(x >= -1.0 && x <= 0.0);
+    return internals::trilog::on_negative_unit(x);
+  }
+  BEAVER_NODISCARD inline double  trilog(double x, region::lower_half_t) noexcept {
+    BEAVER_ASSUME(x >= 0.0 && x <= 0.5);
+    return internals::trilog::on_lower_half(x);
+  }
+  BEAVER_NODISCARD inline double  trilog(double x, region::upper_half_t) noexcept {
+    BEAVER_ASSUME(x > 0.5 && x < 1.0);
+    return internals::trilog::on_upper_half(x);
+  }
+  BEAVER_NODISCARD inline double  trilog(double x, region::unit_interval_t) noexcept {
+    BEAVER_ASSUME(x > 0.0 && x < 1.0);
+    return (x<=0.5) ? internals::trilog::on_lower_half(x) : internals::trilog::on_upper_half(x);
+  }
+  template<class Region>
+  inline void trilog(const double* x, double* out, std::size_t n, Region r) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=trilog(x[i],r);
+    }
+  }
+
+  namespace unchecked {
+    //trilog without argument checks, caller guarantees finite x<1
+  BEAVER_NODISCARD inline double  trilog(double x) noexcept {
+    namespace  LOC=internals::trilog;
+    BEAVER_ASSUME(x < 1.0);
+    if(x<-1) return LOC::on_below_minus_one(x);
+    if(x<=0) return LOC::on_negative_unit(x);
+    if(x<=0.5) return LOC::on_lower_half(x);
+    return LOC::on_upper_half(x);
+  }
+  inline void trilog(const double* x, double* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=trilog(x[i]);
+    }
+  }
+  }
+
+/**
+ * @brief function for the fast computation of the trilogarithm at complex argument
+ * @param z: complex argument (principal branch, cut along [1,inf), Im z=+-0 selects the side)
+ * @return \f$\mathrm{Li}_3(z)\f$
+ */
+  BEAVER_NODISCARD inline std::complex<double>  trilog(std::complex<double> z) noexcept {
+    namespace  LOC=internals::trilog;
+    namespace  C=internals::clog;
+    const double rz=z.real();
+    const double iz=z.imag();
+    //Catch non-finite input
+    if (!std::isfinite(rz) || !std::isfinite(iz)){
+      const double nan=std::numeric_limits<double>::quiet_NaN();
+      return {nan,nan};
+    }
+    //real axis: reuse the real fast path, continue across the cut for x>1
+    if(iz==0){
+      if(rz<=1){
+        return {beaver::trilog(rz), iz};
+      }
+      const double l=beaver::log(rz);
+      const double l2=l*l;
+      return {beaver::trilog(1.0/rz)-1.0/6*l2*l+2*LOC::zeta2*l, std::copysign(0.5*C::pi*l2,iz)};
+    }
+    //strip along the real axis: Li3(x+iy)=Li3(x)+iy Li2(x)/x+O(y^2),
+    //so Im Li3 keeps its relative accuracy as y->0 and Re comes from the real MiniMax kernels.
+    //On the cut x>1 Li2(x)=Re Li2(x)+-i pi log x, which adds -pi|y|log(x)/x to Re
+    if(std::fabs(iz)<LOC::strip*std::fmin(std::fabs(rz),std::fabs(1.0-rz))){
+      if(rz<1){
+        return {beaver::trilog(rz), iz*beaver::dilog(rz)/rz};
+      }
+      const double l=beaver::log(rz);
+      const double l2=l*l;
+      const double li2=2*LOC::zeta2-0.5*l2-beaver::dilog(1.0/rz);//Re Li2(x) on the cut
+      const double re=beaver::trilog(1.0/rz)-1.0/6*l2*l+2*LOC::zeta2*l;
+      return {std::fma(-C::pi*std::fabs(iz),l/rz,re), std::fma(iz,li2/rz,std::copysign(0.5*C::pi*l2,iz))};
+    }
+    const double nz=rz*rz+iz*iz;
+    const double lnz=C::log_abs(rz,iz);
+    const double pz=C::atan2(iz,rz);
+    if(lnz*lnz+pz*pz<1){
+      //expansion around z=1 in v=log(z):
+      //Li3=zeta3+zeta2 v+(3/4-1/2 log(-v))v^2-v^3/12-v^4/288+sum_k zeta(3-k)/k! v^k
+      const std::complex<double> v(lnz,pz);
+      const std::complex<double> v2=C::sqr(v);
+      const std::complex<double> v4=C::sqr(v2);
+      const std::complex<double> lmv=C::log(-v);
+      const std::complex<double> c2=0.75-0.5*lmv;
+      const std::complex<double> tail=C::horner(LOC::V3,7,v2);
+      std::complex<double> r=C::mul(v2,c2+C::mul(v,-1.0/12-1.0/288*v))+C::mul(C::mul(v4,v2),tail);
+      return r+LOC::zeta2*v+LOC::zeta3;
+    }
+    if(nz<=1){
+      const std::complex<double> u=-C::log1p(-z);
+      return C::mul(u,C::horner(LOC::U3,22,u));
+    }
+    //|z|>1: Li3(z)=Li3(1/z)-1/6 log^3(-z)-zeta2 log(-z)
+    //arg(-z) directly: arg(z)-+pi cancels for z close to the negative real axis
+    const std::complex<double> lmz(lnz, C::atan2(-iz,-rz));
+    const std::complex<double> lmz2=C::sqr(lmz);
+    return trilog(C::inv(z))-C::mul(lmz,1.0/6*lmz2+LOC::zeta2);
+  }
+
+  // ----------- batch version over arrays of complex arguments -----------
+  inline void trilog(const std::complex<double>* z, std::complex<double>* out, std::size_t n) noexcept {
+    for(std::size_t i=0;i<n;++i){
+      out[i]=trilog(z[i]);
+    }
+  }
+
 }
-#endif
\ No newline at end of file
+#endif
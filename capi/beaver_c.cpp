@@ -0,0 +1,58 @@
+#include "beaver_c.h"
+#include "beaver.hpp"
+#include <complex>
+
+// std::complex<double> is layout-compatible with double[2] ([complex.numbers.general]),
+// so the {re, im} buffers of the C ABI are reinterpreted in place.
+namespace {
+  inline const std::complex<double>* as_complex(const double* p) noexcept {
+    return reinterpret_cast<const std::complex<double>*>(p);
+  }
+  inline std::complex<double>* as_complex(double* p) noexcept {
+    return reinterpret_cast<std::complex<double>*>(p);
+  }
+}
+
+extern "C" {
+
+const char* beaver_version(void) { return BEAVER_VERSION_STRING; }
+
+double beaver_log(double x)          { return beaver::log(x); }
+double beaver_log1p(double x)        { return beaver::log1p(x); }
+double beaver_arctan(double x)       { return beaver::arctan(x); }
+double beaver_atanint(double x)      { return beaver::atanint(x); }
+double beaver_dilog(double x)        { return beaver::dilog(x); }
+double beaver_trilog(double x)       { return beaver::trilog(x); }
+double beaver_svdilog(double x)      { return beaver::svdilog(x); }
+double beaver_clausen2(double theta) { return beaver::clausen2(theta); }
+double beaver_pow(double x, int n)   { return beaver::pow(x, n); }
+double beaver_log1m(double y)        { return beaver::log1m(y); }
+double beaver_dilog_1m(double y)     { return beaver::dilog_1m(y); }
+double beaver_trilog_1m(double y)    { return beaver::trilog_1m(y); }
+double beaver_svdilog_1m(double y)   { return beaver::svdilog_1m(y); }
+
+void beaver_log_v(const double* x, double* out, size_t n)         { beaver::log(x, out, n); }
+void beaver_log1p_v(const double* x, double* out, size_t n)       { beaver::log1p(x, out, n); }
+void beaver_arctan_v(const double* x, double* out, size_t n)      { beaver::arctan(x, out, n); }
+void beaver_atanint_v(const double* x, double* out, size_t n)     { beaver::atanint(x, out, n); }
+void beaver_dilog_v(const double* x, double* out, size_t n)       { beaver::dilog(x, out, n); }
+void beaver_trilog_v(const double* x, double* out, size_t n)      { beaver::trilog(x, out, n); }
+void beaver_svdilog_v(const double* x, double* out, size_t n)     { beaver::svdilog(x, out, n); }
+void beaver_clausen2_v(const double* theta, double* out, size_t n){ beaver::clausen2(theta, out, n); }
+void beaver_pow_v(const double* x, double* out, size_t n, int e) { beaver::pow(x, out, n, e); }
+void beaver_log1m_v(const double* y, double* out, size_t n)       { beaver::log1m(y, out, n); }
+void beaver_dilog_1m_v(const double* y, double* out, size_t n)    { beaver::dilog_1m(y, out, n); }
+void beaver_trilog_1m_v(const double* y, double* out, size_t n)   { beaver::trilog_1m(y, out, n); }
+void beaver_svdilog_1m_v(const double* y, double* out, size_t n)  { beaver::svdilog_1m(y, out, n); }
+
+void beaver_li2_unit_circle(double theta, double* out) { *as_complex(out) = beaver::li2_unit_circle(theta); }
+void beaver_cdilog(const double* z, double* out)       { *as_complex(out) = beaver::dilog(*as_complex(z)); }
+void beaver_ctrilog(const double* z, double* out)      { *as_complex(out) = beaver::trilog(*as_complex(z)); }
+void beaver_csvdilog(const double* z, double* out)     { *as_complex(out) = beaver::svdilog(*as_complex(z)); }
+
+void beaver_li2_unit_circle_v(const double* theta, double* out, size_t n) { beaver::li2_unit_circle(theta, as_complex(out), n); }
+void beaver_cdilog_v(const double* z, double* out, size_t n)   { beaver::dilog(as_complex(z), as_complex(out), n); }
+void beaver_ctrilog_v(const double* z, double* out, size_t n)  { beaver::trilog(as_complex(z), as_complex(out), n); }
+void beaver_csvdilog_v(const double* z, double* out, size_t n) { beaver::svdilog(as_complex(z), as_complex(out), n); }
+
+} // extern "C"
@@ -0,0 +1,81 @@
+#ifndef BEAVER_C_H
+#define BEAVER_C_H
+/*
+ * C ABI of BEAVER (compiled into libbeaver).
+ *
+ * Scalar functions take and return double. Array forms f_v(x, out, n) evaluate n elements.
+ * They are convenience loops over the checked scalar function, compiled into libbeaver with
+ * the kernels inlined; only beaver_pow_v dispatches on the exponent once per call, to the
+ * unrolled loop of the C++ array pow. Pre-sorted input gains nothing over the scalar form
+ * here: the region-tagged and unchecked entry points are C++ only. Complex arguments and results are
+ * passed as pointers to interleaved {re, im} pairs, which is the layout of C99 double _Complex,
+ * C++ std::complex<double> and Fortran complex(c_double_complex); array forms then hold 2n doubles.
+ */
+#include <stddef.h>
+
+#if defined(_WIN32) && defined(BEAVER_C_SHARED)
+  #if defined(BEAVER_C_BUILDING)
+    #define BEAVER_C_API __declspec(dllexport)
+  #else
+    #define BEAVER_C_API __declspec(dllimport)
+  #endif
+#elif defined(__GNUC__)
+  #define BEAVER_C_API __attribute__((visibility("default")))
+#else
+  #define BEAVER_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* version */
+BEAVER_C_API const char* beaver_version(void);
+
+/* real argument */
+BEAVER_C_API double beaver_log(double x);
+BEAVER_C_API double beaver_log1p(double x);
+BEAVER_C_API double beaver_arctan(double x);
+BEAVER_C_API double beaver_atanint(double x);
+BEAVER_C_API double beaver_dilog(double x);
+BEAVER_C_API double beaver_trilog(double x);
+BEAVER_C_API double beaver_svdilog(double x);
+BEAVER_C_API double beaver_clausen2(double theta);
+BEAVER_C_API double beaver_pow(double x, int n);
+
+/* complementary argument y=1-x, passed exactly */
+BEAVER_C_API double beaver_log1m(double y);
+BEAVER_C_API double beaver_dilog_1m(double y);
+BEAVER_C_API double beaver_trilog_1m(double y);
+BEAVER_C_API double beaver_svdilog_1m(double y);
+
+BEAVER_C_API void beaver_log_v(const double* x, double* out, size_t n);
+BEAVER_C_API void beaver_log1p_v(const double* x, double* out, size_t n);
+BEAVER_C_API void beaver_arctan_v(const double* x, double* out, size_t n);
+BEAVER_C_API void beaver_atanint_v(const double* x, double* out, size_t n);
+BEAVER_C_API void beaver_dilog_v(const double* x, double* out, size_t n);
+BEAVER_C_API void beaver_trilog_v(const double* x, double* out, size_t n);
+BEAVER_C_API void beaver_svdilog_v(const double* x, double* out, size_t n);
+BEAVER_C_API void beaver_clausen2_v(const double* theta, double* out, size_t n);
+BEAVER_C_API void beaver_pow_v(const double* x, double* out, size_t n, int e);
+BEAVER_C_API void beaver_log1m_v(const double* y, double* out, size_t n);
+BEAVER_C_API void beaver_dilog_1m_v(const double* y, double* out, size_t n);
+BEAVER_C_API void beaver_trilog_1m_v(const double* y, double* out, size_t n);
+BEAVER_C_API void beaver_svdilog_1m_v(const double* y, double* out, size_t n);
+
+/* complex argument / result as {re, im} */
+BEAVER_C_API void beaver_li2_unit_circle(double theta, double* out);
+BEAVER_C_API void beaver_cdilog(const double* z, double* out);
+BEAVER_C_API void beaver_ctrilog(const double* z, double* out);
+BEAVER_C_API void beaver_csvdilog(const double* z, double* out);
+
+BEAVER_C_API void beaver_li2_unit_circle_v(const double* theta, double* out, size_t n);
+BEAVER_C_API void beaver_cdilog_v(const double* z, double* out, size_t n);
+BEAVER_C_API void beaver_ctrilog_v(const double* z, double* out, size_t n);
+BEAVER_C_API void beaver_csvdilog_v(const double* z, double* out, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BEAVER_C_H */
@@ -0,0 +1,397 @@
+! Fortran interface to BEAVER through the C ABI of libbeaver (ISO_C_BINDING).
+!
+! Every function is available as a pure generic beaver_<name> for scalar and rank-1 array
+! arguments; the array forms call the beaver_<name>_v entry points once per array. dilog, trilog and svdilog additionally accept complex(c_double_complex);
+! log1m, dilog_1m, trilog_1m and svdilog_1m take the complementary argument y=1-x.
+module beaver
+  use, intrinsic :: iso_c_binding, only: c_double, c_double_complex, c_int, c_size_t
+  implicit none
+  private
+
+  public :: beaver_log, beaver_log1p, beaver_arctan, beaver_atanint, &
+            beaver_dilog, beaver_trilog, beaver_svdilog, beaver_clausen2, &
+            beaver_log1m, beaver_dilog_1m, beaver_trilog_1m, beaver_svdilog_1m, &
+            beaver_pow, beaver_li2_unit_circle
+
+  interface beaver_log
+    pure function beaver_log_s(x) bind(C, name="beaver_log") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: x
+      real(c_double) :: r
+    end function beaver_log_s
+    module procedure beaver_log_a
+  end interface beaver_log
+
+  interface beaver_log1p
+    pure function beaver_log1p_s(x) bind(C, name="beaver_log1p") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: x
+      real(c_double) :: r
+    end function beaver_log1p_s
+    module procedure beaver_log1p_a
+  end interface beaver_log1p
+
+  interface beaver_arctan
+    pure function beaver_arctan_s(x) bind(C, name="beaver_arctan") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: x
+      real(c_double) :: r
+    end function beaver_arctan_s
+    module procedure beaver_arctan_a
+  end interface beaver_arctan
+
+  interface beaver_atanint
+    pure function beaver_atanint_s(x) bind(C, name="beaver_atanint") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: x
+      real(c_double) :: r
+    end function beaver_atanint_s
+    module procedure beaver_atanint_a
+  end interface beaver_atanint
+
+  interface beaver_dilog
+    pure function beaver_dilog_s(x) bind(C, name="beaver_dilog") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: x
+      real(c_double) :: r
+    end function beaver_dilog_s
+    module procedure beaver_dilog_a
+    module procedure beaver_dilog_cs, beaver_dilog_ca
+  end interface beaver_dilog
+
+  interface beaver_trilog
+    pure function beaver_trilog_s(x) bind(C, name="beaver_trilog") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: x
+      real(c_double) :: r
+    end function beaver_trilog_s
+    module procedure beaver_trilog_a
+    module procedure beaver_trilog_cs, beaver_trilog_ca
+  end interface beaver_trilog
+
+  interface beaver_svdilog
+    pure function beaver_svdilog_s(x) bind(C, name="beaver_svdilog") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: x
+      real(c_double) :: r
+    end function beaver_svdilog_s
+    module procedure beaver_svdilog_a
+    module procedure beaver_svdilog_cs, beaver_svdilog_ca
+  end interface beaver_svdilog
+
+  interface beaver_clausen2
+    pure function beaver_clausen2_s(x) bind(C, name="beaver_clausen2") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: x
+      real(c_double) :: r
+    end function beaver_clausen2_s
+    module procedure beaver_clausen2_a
+  end interface beaver_clausen2
+
+  interface beaver_log1m
+    pure function beaver_log1m_s(y) bind(C, name="beaver_log1m") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: y
+      real(c_double) :: r
+    end function beaver_log1m_s
+    module procedure beaver_log1m_a
+  end interface beaver_log1m
+
+  interface beaver_dilog_1m
+    pure function beaver_dilog_1m_s(y) bind(C, name="beaver_dilog_1m") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: y
+      real(c_double) :: r
+    end function beaver_dilog_1m_s
+    module procedure beaver_dilog_1m_a
+  end interface beaver_dilog_1m
+
+  interface beaver_trilog_1m
+    pure function beaver_trilog_1m_s(y) bind(C, name="beaver_trilog_1m") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: y
+      real(c_double) :: r
+    end function beaver_trilog_1m_s
+    module procedure beaver_trilog_1m_a
+  end interface beaver_trilog_1m
+
+  interface beaver_svdilog_1m
+    pure function beaver_svdilog_1m_s(y) bind(C, name="beaver_svdilog_1m") result(r)
+      import :: c_double
+      real(c_double), value, intent(in) :: y
+      real(c_double) :: r
+    end function beaver_svdilog_1m_s
+    module procedure beaver_svdilog_1m_a
+  end interface beaver_svdilog_1m
+
+  interface beaver_pow
+    pure function beaver_pow_s(x, n) bind(C, name="beaver_pow") result(r)
+      import :: c_double, c_int
+      real(c_double), value, intent(in) :: x
+      integer(c_int), value, intent(in) :: n
+      real(c_double) :: r
+    end function beaver_pow_s
+    module procedure beaver_pow_a
+  end interface beaver_pow
+
+  interface beaver_li2_unit_circle
+    module procedure beaver_li2_unit_circle_s, beaver_li2_unit_circle_a
+  end interface beaver_li2_unit_circle
+
+  ! raw C entry points
+  interface
+    pure subroutine c_log_v(x, r, n) bind(C, name="beaver_log_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_log_v
+    pure subroutine c_log1p_v(x, r, n) bind(C, name="beaver_log1p_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_log1p_v
+    pure subroutine c_arctan_v(x, r, n) bind(C, name="beaver_arctan_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_arctan_v
+    pure subroutine c_atanint_v(x, r, n) bind(C, name="beaver_atanint_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_atanint_v
+    pure subroutine c_dilog_v(x, r, n) bind(C, name="beaver_dilog_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_dilog_v
+    pure subroutine c_trilog_v(x, r, n) bind(C, name="beaver_trilog_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_trilog_v
+    pure subroutine c_svdilog_v(x, r, n) bind(C, name="beaver_svdilog_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_svdilog_v
+    pure subroutine c_clausen2_v(x, r, n) bind(C, name="beaver_clausen2_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_clausen2_v
+    pure subroutine c_log1m_v(y, r, n) bind(C, name="beaver_log1m_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: y(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_log1m_v
+    pure subroutine c_dilog_1m_v(y, r, n) bind(C, name="beaver_dilog_1m_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: y(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_dilog_1m_v
+    pure subroutine c_trilog_1m_v(y, r, n) bind(C, name="beaver_trilog_1m_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: y(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_trilog_1m_v
+    pure subroutine c_svdilog_1m_v(y, r, n) bind(C, name="beaver_svdilog_1m_v")
+      import :: c_double, c_size_t
+      real(c_double), intent(in) :: y(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_svdilog_1m_v
+    pure subroutine c_pow_v(x, r, n, e) bind(C, name="beaver_pow_v")
+      import :: c_double, c_int, c_size_t
+      real(c_double), intent(in) :: x(*)
+      real(c_double), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+      integer(c_int), value, intent(in) :: e
+    end subroutine c_pow_v
+    pure subroutine c_li2_unit_circle(theta, r) bind(C, name="beaver_li2_unit_circle")
+      import :: c_double, c_double_complex
+      real(c_double), value, intent(in) :: theta
+      complex(c_double_complex), intent(out) :: r
+    end subroutine c_li2_unit_circle
+    pure subroutine c_li2_unit_circle_v(theta, r, n) bind(C, name="beaver_li2_unit_circle_v")
+      import :: c_double, c_double_complex, c_size_t
+      real(c_double), intent(in) :: theta(*)
+      complex(c_double_complex), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_li2_unit_circle_v
+    pure subroutine c_cdilog(z, r) bind(C, name="beaver_cdilog")
+      import :: c_double_complex
+      complex(c_double_complex), intent(in) :: z
+      complex(c_double_complex), intent(out) :: r
+    end subroutine c_cdilog
+    pure subroutine c_cdilog_v(z, r, n) bind(C, name="beaver_cdilog_v")
+      import :: c_double_complex, c_size_t
+      complex(c_double_complex), intent(in) :: z(*)
+      complex(c_double_complex), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_cdilog_v
+    pure subroutine c_ctrilog(z, r) bind(C, name="beaver_ctrilog")
+      import :: c_double_complex
+      complex(c_double_complex), intent(in) :: z
+      complex(c_double_complex), intent(out) :: r
+    end subroutine c_ctrilog
+    pure subroutine c_ctrilog_v(z, r, n) bind(C, name="beaver_ctrilog_v")
+      import :: c_double_complex, c_size_t
+      complex(c_double_complex), intent(in) :: z(*)
+      complex(c_double_complex), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_ctrilog_v
+    pure subroutine c_csvdilog(z, r) bind(C, name="beaver_csvdilog")
+      import :: c_double_complex
+      complex(c_double_complex), intent(in) :: z
+      complex(c_double_complex), intent(out) :: r
+    end subroutine c_csvdilog
+    pure subroutine c_csvdilog_v(z, r, n) bind(C, name="beaver_csvdilog_v")
+      import :: c_double_complex, c_size_t
+      complex(c_double_complex), intent(in) :: z(*)
+      complex(c_double_complex), intent(out) :: r(*)
+      integer(c_size_t), value, intent(in) :: n
+    end subroutine c_csvdilog_v
+  end interface
+
+contains
+
+  pure function beaver_log_a(x) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    real(c_double) :: r(size(x))
+    call c_log_v(x, r, size(x, kind=c_size_t))
+  end function beaver_log_a
+
+  pure function beaver_log1p_a(x) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    real(c_double) :: r(size(x))
+    call c_log1p_v(x, r, size(x, kind=c_size_t))
+  end function beaver_log1p_a
+
+  pure function beaver_arctan_a(x) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    real(c_double) :: r(size(x))
+    call c_arctan_v(x, r, size(x, kind=c_size_t))
+  end function beaver_arctan_a
+
+  pure function beaver_atanint_a(x) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    real(c_double) :: r(size(x))
+    call c_atanint_v(x, r, size(x, kind=c_size_t))
+  end function beaver_atanint_a
+
+  pure function beaver_dilog_a(x) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    real(c_double) :: r(size(x))
+    call c_dilog_v(x, r, size(x, kind=c_size_t))
+  end function beaver_dilog_a
+
+  pure function beaver_trilog_a(x) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    real(c_double) :: r(size(x))
+    call c_trilog_v(x, r, size(x, kind=c_size_t))
+  end function beaver_trilog_a
+
+  pure function beaver_svdilog_a(x) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    real(c_double) :: r(size(x))
+    call c_svdilog_v(x, r, size(x, kind=c_size_t))
+  end function beaver_svdilog_a
+
+  pure function beaver_clausen2_a(x) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    real(c_double) :: r(size(x))
+    call c_clausen2_v(x, r, size(x, kind=c_size_t))
+  end function beaver_clausen2_a
+
+  pure function beaver_log1m_a(y) result(r)
+    real(c_double), intent(in), contiguous :: y(:)
+    real(c_double) :: r(size(y))
+    call c_log1m_v(y, r, size(y, kind=c_size_t))
+  end function beaver_log1m_a
+
+  pure function beaver_dilog_1m_a(y) result(r)
+    real(c_double), intent(in), contiguous :: y(:)
+    real(c_double) :: r(size(y))
+    call c_dilog_1m_v(y, r, size(y, kind=c_size_t))
+  end function beaver_dilog_1m_a
+
+  pure function beaver_trilog_1m_a(y) result(r)
+    real(c_double), intent(in), contiguous :: y(:)
+    real(c_double) :: r(size(y))
+    call c_trilog_1m_v(y, r, size(y, kind=c_size_t))
+  end function beaver_trilog_1m_a
+
+  pure function beaver_svdilog_1m_a(y) result(r)
+    real(c_double), intent(in), contiguous :: y(:)
+    real(c_double) :: r(size(y))
+    call c_svdilog_1m_v(y, r, size(y, kind=c_size_t))
+  end function beaver_svdilog_1m_a
+
+  pure function beaver_dilog_cs(z) result(r)
+    complex(c_double_complex), intent(in) :: z
+    complex(c_double_complex) :: r
+    call c_cdilog(z, r)
+  end function beaver_dilog_cs
+
+  pure function beaver_dilog_ca(z) result(r)
+    complex(c_double_complex), intent(in), contiguous :: z(:)
+    complex(c_double_complex) :: r(size(z))
+    call c_cdilog_v(z, r, size(z, kind=c_size_t))
+  end function beaver_dilog_ca
+
+  pure function beaver_trilog_cs(z) result(r)
+    complex(c_double_complex), intent(in) :: z
+    complex(c_double_complex) :: r
+    call c_ctrilog(z, r)
+  end function beaver_trilog_cs
+
+  pure function beaver_trilog_ca(z) result(r)
+    complex(c_double_complex), intent(in), contiguous :: z(:)
+    complex(c_double_complex) :: r(size(z))
+    call c_ctrilog_v(z, r, size(z, kind=c_size_t))
+  end function beaver_trilog_ca
+
+  pure function beaver_svdilog_cs(z) result(r)
+    complex(c_double_complex), intent(in) :: z
+    complex(c_double_complex) :: r
+    call c_csvdilog(z, r)
+  end function beaver_svdilog_cs
+
+  pure function beaver_svdilog_ca(z) result(r)
+    complex(c_double_complex), intent(in), contiguous :: z(:)
+    complex(c_double_complex) :: r(size(z))
+    call c_csvdilog_v(z, r, size(z, kind=c_size_t))
+  end function beaver_svdilog_ca
+
+  pure function beaver_pow_a(x, n) result(r)
+    real(c_double), intent(in), contiguous :: x(:)
+    integer(c_int), intent(in) :: n
+    real(c_double) :: r(size(x))
+    call c_pow_v(x, r, size(x, kind=c_size_t), n)
+  end function beaver_pow_a
+
+  pure function beaver_li2_unit_circle_s(theta) result(r)
+    real(c_double), intent(in) :: theta
+    complex(c_double_complex) :: r
+    call c_li2_unit_circle(theta, r)
+  end function beaver_li2_unit_circle_s
+
+  pure function beaver_li2_unit_circle_a(theta) result(r)
+    real(c_double), intent(in), contiguous :: theta(:)
+    complex(c_double_complex) :: r(size(theta))
+    call c_li2_unit_circle_v(theta, r, size(theta, kind=c_size_t))
+  end function beaver_li2_unit_circle_a
+
+end module beaver
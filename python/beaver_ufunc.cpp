@@ -0,0 +1,332 @@
+// NumPy ufuncs on top of the BEAVER kernels.
+//
+// Written against the plain NumPy C API (PyUFunc_FromFuncAndData): the functions are registered as
+// real ufuncs, so NumPy takes care of broadcasting, strides, dtype casting and out=/where=, and the
+// module builds offline against nothing but the Python and NumPy headers.
+// float32 loops evaluate the double kernels and round the result.
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include <numpy/arrayobject.h>
+#include <numpy/ufuncobject.h>
+
+#include "beaver.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace {
+  // ----------- threading -----------
+  // Inner loops longer than 2*grain elements are split into contiguous chunks. The first chunk runs on
+  // the calling thread, the others on a persistent pool of workers, so a chunked ufunc call pays no
+  // thread start-up. GIL: NumPy releases it around the inner loops of non-object dtypes, and neither
+  // the loops nor the workers touch Python objects, so nothing here acquires or releases it (the workers
+  // are not Python threads and must not call into Python). Nothing may throw out of a loop either, it is
+  // called from C: a worker that cannot be started or a chunk that cannot be queued runs on the caller.
+  std::atomic<int> num_threads{static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))};
+  constexpr npy_intp grain = 1 << 15;
+
+  inline long process_id() noexcept {
+#if defined(_WIN32)
+    return 0;
+#else
+    return static_cast<long>(::getpid());
+#endif
+  }
+
+  class thread_pool {
+  public:
+    const long pid = process_id();
+
+    // body(b, e) over [0, n) in t chunks; returns when all of them are done
+    template<class Body>
+    void run(npy_intp t, npy_intp n, const Body& body) {
+      const npy_intp chunk = (n + t - 1) / t;
+      npy_intp pending = 0;
+      npy_intp queued = chunk;  // [chunk, queued) is on the queue, [queued, n) left to the caller
+      {
+        std::lock_guard<std::mutex> lock(m);
+        start_workers(t - 1);
+        if (workers > 0) {
+          for (npy_intp b = chunk; b < n; b += chunk) {
+            const npy_intp e = std::min(n, b + chunk);
+            try {
+              queue.push_back({&call<Body>, &body, b, e, &pending});
+            } catch (...) {
+              break;
+            }
+            ++pending;
+            queued = e;
+          }
+        }
+      }
+      work.notify_all();
+      body(npy_intp{0}, std::min(n, chunk));
+      if (queued < n) body(queued, n);
+      // help with queued chunks (of this or another call) until this call's are done
+      std::unique_lock<std::mutex> lock(m);
+      while (pending > 0) {
+        if (queue.empty()) {
+          done.wait(lock);
+        } else {
+          execute(lock);
+        }
+      }
+    }
+
+  private:
+    struct task {
+      void (*fn)(const void*, npy_intp, npy_intp);
+      const void* body;
+      npy_intp b, e;
+      npy_intp* pending;  // guarded by m
+    };
+    template<class Body>
+    static void call(const void* body, npy_intp b, npy_intp e) { (*static_cast<const Body*>(body))(b, e); }
+
+    std::mutex m;
+    std::condition_variable work, done;
+    std::deque<task> queue;
+    npy_intp workers = 0;
+
+    // called with m held
+    void start_workers(npy_intp k) noexcept {
+      while (workers < k) {
+        try {
+          std::thread([this] { worker(); }).detach();
+        } catch (...) {
+          return;
+        }
+        ++workers;
+      }
+    }
+    // called with m held: pops one task and runs it unlocked
+    void execute(std::unique_lock<std::mutex>& lock) {
+      const task w = queue.front();
+      queue.pop_front();
+      lock.unlock();
+      w.fn(w.body, w.b, w.e);
+      lock.lock();
+      if (--*w.pending == 0) done.notify_all();
+    }
+    void worker() {
+      std::unique_lock<std::mutex> lock(m);
+      for (;;) {
+        work.wait(lock, [this] { return !queue.empty(); });
+        execute(lock);
+      }
+    }
+  };
+
+  // The pool of this process. The workers are detached and the pool is never destroyed, so interpreter
+  // shutdown does not wait on them. A child after fork() has none of the parent's workers (and maybe a
+  // lock held at the fork), it starts a fresh pool and leaks the inherited one.
+  thread_pool* pool() noexcept {
+    static std::atomic<thread_pool*> current{nullptr};
+    thread_pool* p = current.load(std::memory_order_acquire);
+    while (p == nullptr || p->pid != process_id()) {
+      thread_pool* fresh = new (std::nothrow) thread_pool;
+      if (fresh == nullptr) return nullptr;
+      if (current.compare_exchange_strong(p, fresh, std::memory_order_acq_rel)) return fresh;
+      delete fresh;
+    }
+    return p;
+  }
+
+  template<class Body>
+  void parallel_for(npy_intp n, const Body& body) {
+    const npy_intp t = std::min<npy_intp>(num_threads.load(std::memory_order_relaxed), n / grain);
+    thread_pool* p = (t > 1) ? pool() : nullptr;
+    if (p == nullptr) {
+      body(npy_intp{0}, n);
+      return;
+    }
+    p->run(t, n, body);
+  }
+
+  // ----------- loops -----------
+  // F is a functor double->double (or complex->complex); T the storage type of the array.
+  template<class F, class T>
+  void unary_loop(char** args, const npy_intp* dims, const npy_intp* steps, void*) {
+    char* in = args[0];
+    char* out = args[1];
+    const npy_intp is = steps[0];
+    const npy_intp os = steps[1];
+    parallel_for(dims[0], [=](npy_intp b, npy_intp e) {
+      if (is == sizeof(T) && os == sizeof(T)) {
+        const T* x = reinterpret_cast<const T*>(in) + b;
+        T* y = reinterpret_cast<T*>(out) + b;
+        for (npy_intp i = 0; i < e - b; ++i) y[i] = static_cast<T>(F{}(x[i]));
+      } else {
+        for (npy_intp i = b; i < e; ++i) {
+          *reinterpret_cast<T*>(out + i * os) = static_cast<T>(F{}(*reinterpret_cast<const T*>(in + i * is)));
+        }
+      }
+    });
+  }
+
+  // beaver::pow takes an int exponent. Wider exponents beyond the int range go to std::pow on |x|,
+  // with the sign from the parity of k, which the conversion to double loses above 2^53.
+  template<class I>
+  bool fits_int(I k) noexcept {
+    if constexpr (sizeof(I) <= sizeof(int)) {
+      return true;
+    } else {
+      return k >= INT_MIN && k <= INT_MAX;
+    }
+  }
+  template<class I>
+  double pow_int(double x, I k) noexcept {
+    if (fits_int(k)) return beaver::pow(x, static_cast<int>(k));
+    const double r = std::pow(std::fabs(x), static_cast<double>(k));
+    return (std::signbit(x) && (k & 1) != 0) ? -r : r;
+  }
+
+  // pow(x, n) with an integer exponent array of type I
+  template<class T, class I>
+  void pow_loop(char** args, const npy_intp* dims, const npy_intp* steps, void*) {
+    char* in = args[0];
+    char* ex = args[1];
+    char* out = args[2];
+    const npy_intp is = steps[0];
+    const npy_intp es = steps[1];
+    const npy_intp os = steps[2];
+    parallel_for(dims[0], [=](npy_intp b, npy_intp e) {
+      if (std::is_same_v<T, double> && es == 0 && is == sizeof(T) && os == sizeof(T)) {
+        const I k = *reinterpret_cast<const I*>(ex);
+        if (fits_int(k)) {
+          // broadcast exponent: dispatch once to the unrolled array form
+          beaver::pow(reinterpret_cast<const T*>(in) + b, reinterpret_cast<T*>(out) + b,
+                      static_cast<std::size_t>(e - b), static_cast<int>(k));
+          return;
+        }
+      }
+      for (npy_intp i = b; i < e; ++i) {
+        const double x = *reinterpret_cast<const T*>(in + i * is);
+        const I k = *reinterpret_cast<const I*>(ex + i * es);
+        *reinterpret_cast<T*>(out + i * os) = static_cast<T>(pow_int(x, k));
+      }
+    });
+  }
+
+  // ----------- kernels as functors, so that they inline into the loops -----------
+#define BEAVER_REAL_FUNCTOR(name) \
+  struct name##_fn { double operator()(double x) const noexcept { return beaver::name(x); } };
+#define BEAVER_COMPLEX_FUNCTOR(name) \
+  struct c##name##_fn { \
+    std::complex<double> operator()(std::complex<double> z) const noexcept { return beaver::name(z); } \
+    std::complex<float> operator()(std::complex<float> z) const noexcept { \
+      return std::complex<float>(beaver::name(std::complex<double>(z))); \
+    } \
+  };
+  BEAVER_REAL_FUNCTOR(log)
+  BEAVER_REAL_FUNCTOR(log1p)
+  BEAVER_REAL_FUNCTOR(arctan)
+  BEAVER_REAL_FUNCTOR(atanint)
+  BEAVER_REAL_FUNCTOR(dilog)
+  BEAVER_REAL_FUNCTOR(trilog)
+  BEAVER_REAL_FUNCTOR(svdilog)
+  BEAVER_COMPLEX_FUNCTOR(dilog)
+  BEAVER_COMPLEX_FUNCTOR(trilog)
+  BEAVER_COMPLEX_FUNCTOR(svdilog)
+#undef BEAVER_REAL_FUNCTOR
+#undef BEAVER_COMPLEX_FUNCTOR
+
+  // ----------- loop tables (must outlive the ufuncs) -----------
+  template<class F>
+  struct real_table {
+    static inline PyUFuncGenericFunction funcs[] = {
+      &unary_loop<F, float>, &unary_loop<F, double>};
+    static inline char types[] = {NPY_FLOAT, NPY_FLOAT, NPY_DOUBLE, NPY_DOUBLE};
+    static inline void* data[] = {nullptr, nullptr};
+  };
+  template<class F, class C>
+  struct complex_table {
+    static inline PyUFuncGenericFunction funcs[] = {
+      &unary_loop<F, float>, &unary_loop<F, double>,
+      &unary_loop<C, std::complex<float>>, &unary_loop<C, std::complex<double>>};
+    static inline char types[] = {NPY_FLOAT, NPY_FLOAT, NPY_DOUBLE, NPY_DOUBLE,
+                                  NPY_CFLOAT, NPY_CFLOAT, NPY_CDOUBLE, NPY_CDOUBLE};
+    static inline void* data[] = {nullptr, nullptr, nullptr, nullptr};
+  };
+  struct pow_table {
+    static inline PyUFuncGenericFunction funcs[] = {
+      &pow_loop<float, std::int32_t>, &pow_loop<float, std::int64_t>,
+      &pow_loop<double, std::int32_t>, &pow_loop<double, std::int64_t>};
+    static inline char types[] = {NPY_FLOAT, NPY_INT32, NPY_FLOAT, NPY_FLOAT, NPY_INT64, NPY_FLOAT,
+                                  NPY_DOUBLE, NPY_INT32, NPY_DOUBLE, NPY_DOUBLE, NPY_INT64, NPY_DOUBLE};
+    static inline void* data[] = {nullptr, nullptr, nullptr, nullptr};
+  };
+
+  template<class Table>
+  int add_ufunc(PyObject* m, const char* name, int nin, const char* doc) {
+    constexpr int ntypes = sizeof(Table::funcs) / sizeof(Table::funcs[0]);
+    PyObject* f = PyUFunc_FromFuncAndData(Table::funcs, Table::data, Table::types, ntypes,
+                                          nin, 1, PyUFunc_None, name, doc, 0);
+    if (f == nullptr) return -1;
+    if (PyModule_AddObject(m, name, f) < 0) {
+      Py_DECREF(f);
+      return -1;
+    }
+    return 0;
+  }
+
+  // ----------- module functions -----------
+  PyObject* set_num_threads(PyObject*, PyObject* arg) {
+    const long n = PyLong_AsLong(arg);
+    if (n == -1 && PyErr_Occurred()) return nullptr;
+    if (n < 1) {
+      PyErr_SetString(PyExc_ValueError, "number of threads must be >= 1");
+      return nullptr;
+    }
+    num_threads.store(static_cast<int>(std::min<long>(n, INT_MAX)), std::memory_order_relaxed);
+    Py_RETURN_NONE;
+  }
+  PyObject* get_num_threads(PyObject*, PyObject*) {
+    return PyLong_FromLong(num_threads.load(std::memory_order_relaxed));
+  }
+
+  PyMethodDef methods[] = {
+    {"set_num_threads", set_num_threads, METH_O,
+     "set_num_threads(n)\n\nNumber of threads used by the ufunc loops on large arrays (default: hardware threads)."},
+    {"get_num_threads", get_num_threads, METH_NOARGS,
+     "get_num_threads()\n\nNumber of threads used by the ufunc loops on large arrays."},
+    {nullptr, nullptr, 0, nullptr}};
+
+  PyModuleDef module = {
+    PyModuleDef_HEAD_INIT, "beaver",
+    "BEAVER special functions as NumPy ufuncs (float32, float64; complex for dilog, trilog, svdilog).",
+    -1, methods, nullptr, nullptr, nullptr, nullptr};
+}
+
+PyMODINIT_FUNC PyInit_beaver(void) {
+  import_array();
+  import_umath();
+  PyObject* m = PyModule_Create(&module);
+  if (m == nullptr) return nullptr;
+  if (add_ufunc<real_table<log_fn>>(m, "log", 1, "log(x)\n\nNatural logarithm.") < 0 ||
+      add_ufunc<real_table<log1p_fn>>(m, "log1p", 1, "log1p(x)\n\nlog(1+x).") < 0 ||
+      add_ufunc<real_table<arctan_fn>>(m, "arctan", 1, "arctan(x)\n\nInverse tangent.") < 0 ||
+      add_ufunc<real_table<atanint_fn>>(m, "atanint", 1, "atanint(x)\n\nInverse tangent integral Ti2(x).") < 0 ||
+      add_ufunc<complex_table<dilog_fn, cdilog_fn>>(m, "dilog", 1, "dilog(x)\n\nDilogarithm Li2(x); real arguments x > 1 give nan, pass complex input for the continuation.") < 0 ||
+      add_ufunc<complex_table<trilog_fn, ctrilog_fn>>(m, "trilog", 1, "trilog(x)\n\nTrilogarithm Li3(x); real arguments x > 1 give nan, pass complex input for the continuation.") < 0 ||
+      add_ufunc<complex_table<svdilog_fn, csvdilog_fn>>(m, "svdilog", 1, "svdilog(x)\n\nSingle-valued dilogarithm L2(x); imaginary part D(z) for complex z.") < 0 ||
+      add_ufunc<pow_table>(m, "pow", 2, "pow(x, n)\n\nx**n for an integer exponent n.") < 0 ||
+      PyModule_AddStringConstant(m, "__version__", BEAVER_VERSION_STRING) < 0) {
+    Py_DECREF(m);
+    return nullptr;
+  }
+  return m;
+}
@@ -0,0 +1,60 @@
+#ifndef BEAVER_TESTS_CHECK_HPP
+#define BEAVER_TESTS_CHECK_HPP
+// Minimal assertion helpers for the test executables: every failed check prints one line,
+// report() turns the failure count into the exit status seen by ctest.
+#include <cmath>
+#include <complex>
+#include <cstdio>
+
+namespace beaver_test {
+  inline int failures=0;
+
+  //relative deviation |got-ref|/max(|ref|,floor); floor>0 switches to an absolute measure near zeros of ref
+  inline double deviation(double got, double ref, double floor=0.0) noexcept {
+    if(got==ref) return 0.0;
+    return std::fabs(got-ref)/std::fmax(std::fabs(ref),floor);
+  }
+
+  inline void check(const char* what, bool ok) {
+    if(!ok){
+      ++failures;
+      std::printf("FAIL %s\n",what);
+    }
+  }
+
+  inline void check_close(const char* what, double arg, double got, double ref, double tol, double floor=0.0) {
+    const double err=deviation(got,ref,floor);
+    if(!(err<=tol)){
+      ++failures;
+      std::printf("FAIL %s(%.17g): got %.17g, expected %.17g (deviation %.2e > %.2e)\n",what,arg,got,ref,err,tol);
+    }
+  }
+
+  inline void check_close(const char* what, std::complex<double> arg, double got, double ref, double tol, double floor=0.0) {
+    const double err=deviation(got,ref,floor);
+    if(!(err<=tol)){
+      ++failures;
+      std::printf("FAIL %s(%.17g%+.17gi): got %.17g, expected %.17g (deviation %.2e > %.2e)\n",
+                  what,arg.real(),arg.imag(),got,ref,err,tol);
+    }
+  }
+
+  //bitwise equality, so that NaN==NaN and -0!=+0 count as expected
+  inline void check_same(const char* what, double arg, double got, double ref) {
+    const bool same=(got==ref && std::signbit(got)==std::signbit(ref)) || (std::isnan(got) && std::isnan(ref));
+    if(!same){
+      ++failures;
+      std::printf("FAIL %s(%.17g): got %.17g, expected %.17g bit for bit\n",what,arg,got,ref);
+    }
+  }
+
+  inline int report(const char* name) {
+    if(failures!=0){
+      std::printf("%s: %d check(s) failed\n",name,failures);
+      return 1;
+    }
+    std::printf("%s: all checks passed\n",name);
+    return 0;
+  }
+}
+#endif
@@ -0,0 +1,106 @@
+// Functions of the complementary argument y=1-x: against reference values (mpmath, 60 digits) also
+// where 1-y rounds, and against the direct functions where 1-y is exact. There dilog_1m, trilog_1m
+// and svdilog_1m run the kernels of dilog, trilog and svdilog on the same mapped argument, so they
+// agree bit for bit (svdilog_1m for y<0 only up to the rounding of its own mapped argument); log1m
+// is log1p(-y) and agrees with log(1-y) to rounding.
+#include "beaver.hpp"
+#include "check.hpp"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+  struct point { double y, log1m, li2, li3, sv; };
+  const double undefined=std::numeric_limits<double>::quiet_NaN();
+  //{y, log(1-y), Li2(1-y), Li3(1-y), L2(1-y)}, undefined where 1-y<0 for the logarithm
+  const point points[]={
+    {1e-300, -1e-300, 1.6449340668482264365, 1.2020569031595942854, 1.6449340668482264365},
+    {1e-20, -1.0e-20, 1.644934066848226436, 1.2020569031595942854, 1.6449340668482264362},
+    {1.25e-12, -1.25000000000078125e-12, 1.6449340668127165895, 1.2020569031575381178, 1.644934066829846513},
+    {3e-05, -3.0000450009000202505e-5, 1.6445916325413997126, 1.2020075597589509806, 1.6447478495823115745},
+    {0.0001, -1.0000500033335833533e-4, 1.6439129842561454972, 1.2018924550845816071, 1.6443735243021304082},
+    {0.001, -1.0005003335835335001e-3, 1.6370226052761177427, 1.2004153539954643452, 1.640478211006585264},
+    {0.25, -0.28768207245178092744, 0.97846939293030610374, 0.8444258088622044485, 1.1778754103478999666},
+    {0.5, -0.69314718055994530942, 0.5822405264650125059, 0.53721319360804020094, 0.82246703342411321824},
+    {0.75, -1.3862943611198906188, 0.26765263908273260692, 0.25846139579657330529, 0.46705865650032646982},
+    {1.0, -std::numeric_limits<double>::infinity(), 0.0, 0.0, 0.0},
+    {1.5, undefined, -0.44841420692364620244, -0.47259784465889687462, -0.58893770517394998332},
+    {2.0, undefined, -0.82246703342411321824, -0.90154267736969571405, -0.82246703342411321824},
+    {3.0, undefined, -1.4367463668836809464, -1.668283363966571212, -1.0559963616742764531},
+    {100.0, undefined, -12.192421669033171348, -23.7398469152502332, -1.6117672015922313345},
+    {1e6, undefined, -97.079085239941674902, -462.21608382394682961, -1.6449261590892435743},
+  };
+  //y<0 (x>1): only the single-valued dilogarithm is real there
+  const double negative[][2]={
+    {-1e-10, 1.6449340680995189829},
+    {-0.5, 2.2338717720221764198},
+    {-1.0, 2.4674011002723396547},
+    {-3.0, 2.8228094771961264031},
+    {-1e4, 3.2893076422020589473},
+  };
+  const double tol=4e-15;
+}
+
+int main() {
+  using beaver_test::check_close;
+  using beaver_test::check_same;
+  const double nan=std::numeric_limits<double>::quiet_NaN();
+  for(const point& p : points){
+    if(std::isfinite(p.log1m)) check_close("log1m",p.y,beaver::log1m(p.y),p.log1m,tol);
+    else check_same("log1m",p.y,beaver::log1m(p.y),p.log1m);
+    check_close("dilog_1m",p.y,beaver::dilog_1m(p.y),p.li2,tol);
+    check_close("trilog_1m",p.y,beaver::trilog_1m(p.y),p.li3,tol);
+    check_close("svdilog_1m",p.y,beaver::svdilog_1m(p.y),p.sv,tol);
+  }
+  for(const auto& p : negative){
+    check_close("svdilog_1m",p[0],beaver::svdilog_1m(p[0]),p[1],tol);
+    check_same("dilog_1m",p[0],beaver::dilog_1m(p[0]),nan);
+    check_same("trilog_1m",p[0],beaver::trilog_1m(p[0]),nan);
+  }
+  check_same("dilog_1m",0.0,beaver::dilog_1m(0.0),beaver::dilog(1.0));
+  check_same("trilog_1m",0.0,beaver::trilog_1m(0.0),beaver::trilog(1.0));
+  check_same("svdilog_1m",0.0,beaver::svdilog_1m(0.0),beaver::svdilog(1.0));
+  for(double v : {nan,std::numeric_limits<double>::infinity()}){
+    check_same("dilog_1m",v,beaver::dilog_1m(v),nan);
+    check_same("trilog_1m",v,beaver::trilog_1m(v),nan);
+    check_same("svdilog_1m",v,beaver::svdilog_1m(v),nan);
+  }
+
+  //consistency with the direct functions where x=1-y is exact: y in [1/2,2] (Sterbenz) and y on a
+  //2^-20 grid, which covers both sides of every region switch
+  std::mt19937_64 gen(11);
+  std::uniform_real_distribution<double> near(0.5,2.0);
+  std::uniform_real_distribution<double> wide(-1e4,1e4);
+  std::vector<double> y;
+  for(int i=0;i<20000;++i){
+    y.push_back(near(gen));
+    const double v=std::ldexp(std::round(std::ldexp(wide(gen)*std::pow(1e-4,i%3),20)),-20);
+    if(v!=0 && 1-(1-v)==v) y.push_back(v);
+  }
+  for(double v : {0.5,1.0,1.5,2.0,0.25,-0.5}) y.push_back(v);
+  for(double v : y){
+    const double x=1-v;
+    if(1-x!=v) continue;
+    if(v>=0){
+      check_same("dilog_1m vs dilog",v,beaver::dilog_1m(v),beaver::dilog(x));
+      check_same("trilog_1m vs trilog",v,beaver::trilog_1m(v),beaver::trilog(x));
+    }
+    //for 1<x<2 the mapped argument is -y/(1-y) instead of 1-1/x, which rounds differently
+    if(v<0 && v>-1) check_close("svdilog_1m vs svdilog",v,beaver::svdilog_1m(v),beaver::svdilog(x),2*tol);
+    else if(v!=1 && v!=0) check_same("svdilog_1m vs svdilog",v,beaver::svdilog_1m(v),beaver::svdilog(x));
+    if(v<1) check_close("log1m vs log",v,beaver::log1m(v),beaver::log(x),2*tol);
+  }
+
+  //array forms: same results as the scalar calls
+  std::vector<double> out(y.size());
+  beaver::log1m(y.data(),out.data(),y.size());
+  for(std::size_t i=0;i<y.size();++i) check_same("log1m array",y[i],out[i],beaver::log1m(y[i]));
+  beaver::dilog_1m(y.data(),out.data(),y.size());
+  for(std::size_t i=0;i<y.size();++i) check_same("dilog_1m array",y[i],out[i],beaver::dilog_1m(y[i]));
+  beaver::trilog_1m(y.data(),out.data(),y.size());
+  for(std::size_t i=0;i<y.size();++i) check_same("trilog_1m array",y[i],out[i],beaver::trilog_1m(y[i]));
+  beaver::svdilog_1m(y.data(),out.data(),y.size());
+  for(std::size_t i=0;i<y.size();++i) check_same("svdilog_1m array",y[i],out[i],beaver::svdilog_1m(y[i]));
+  return beaver_test::report("1m");
+}
@@ -0,0 +1,180 @@
+// Runtime approximants: the tolerance holds on the verification grid of build() and max_error() is
+// the largest deviation found there; serialized blobs evaluate identically, and truncated, corrupt,
+// crafted or misaligned blobs are rejected with std::invalid_argument.
+#include "beaver.hpp"
+#include "check.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  namespace LOC=beaver::internals::approximant;
+
+  template<class Call>
+  bool throws_invalid(Call call) {
+    try {
+      call();
+    } catch (const std::invalid_argument&) {
+      return true;
+    } catch (...) {
+      return false;
+    }
+    return false;
+  }
+  template<class Call>
+  bool throws_runtime(Call call) {
+    try {
+      call();
+    } catch (const std::runtime_error&) {
+      return true;
+    } catch (...) {
+      return false;
+    }
+    return false;
+  }
+
+  bool rejected(const std::vector<unsigned char>& blob) {
+    return throws_invalid([&] { (void)beaver::approximant_view::from_blob(blob.data(),blob.size()); })
+        && throws_invalid([&] { (void)beaver::approximant::deserialize(blob.data(),blob.size()); });
+  }
+  LOC::header header_of(const std::vector<unsigned char>& blob) {
+    LOC::header h;
+    std::memcpy(&h,blob.data(),sizeof(h));
+    return h;
+  }
+  std::vector<unsigned char> with_header(std::vector<unsigned char> blob, const LOC::header& h) {
+    std::memcpy(blob.data(),&h,sizeof(h));
+    return blob;
+  }
+  double f(double x) { return std::exp(x)*std::sin(3*x)+10; }
+}
+
+int main() {
+  using beaver_test::check;
+  const double rtol=1e-13;
+  const beaver::approximant_options opt{12,0.0,1u<<14,4};
+  const beaver::approximant A=beaver::approximant::build(f,-1.0,2.0,rtol,opt);
+  check("approximant has pieces",A.pieces()>1 && A.degree()==12);
+  check("approximant range",A.lower()==-1.0 && A.upper()==2.0);
+
+  //verification grid of build(): check_factor*(degree+1)+1 uniform points per piece, both ends included
+  const std::vector<unsigned char> blob=A.serialize();
+  const double* breaks=reinterpret_cast<const double*>(blob.data()+sizeof(LOC::header));
+  const double* pieces=breaks+A.pieces()+1;
+  const int n=opt.degree+1;
+  const int m=opt.check_factor*n;
+  double max_err=0;
+  for(std::size_t p=0;p<A.pieces();++p){
+    //each grid point on its own piece (A(x) takes a shared end point from the piece to its left)
+    const double* piece=pieces+p*static_cast<std::size_t>(n+2);
+    const double lo=breaks[p];
+    const double hi=breaks[p+1];
+    for(int i=0;i<=m;++i){
+      const double x=(i==m) ? hi : lo+(hi-lo)*i/m;
+      const double y=LOC::estrin(piece+2,n,(x-piece[0])*piece[1]);
+      beaver_test::check_close("approximant on the grid",x,y,f(x),rtol);
+      max_err=std::fmax(max_err,std::fabs(y-f(x)));
+    }
+    if(p>0) check("approximant continuous at a break",std::fabs(A(lo)-f(lo))<=rtol*std::fabs(f(lo)));
+  }
+  check("max_error is the largest deviation on the grid",A.max_error()==max_err);
+  //off the grid the tolerance is not guaranteed, but a converged fit stays close to it
+  for(int i=0;i<=3001;++i){
+    const double x=-1.0+3.0*i/3001;
+    beaver_test::check_close("approximant off the grid",x,A(x),f(x),10*rtol);
+  }
+  check("approximant NaN outside [a,b]",std::isnan(A(-1.0000001)) && std::isnan(A(2.5)) && std::isnan(A(std::nan(""))));
+
+  //round trip: view over the blob, deserialized copy, batch form
+  const beaver::approximant_view V=beaver::approximant_view::from_blob(blob.data(),blob.size());
+  const beaver::approximant B=beaver::approximant::deserialize(blob.data(),blob.size());
+  std::vector<double> x, out(1001);
+  for(int i=0;i<=1000;++i) x.push_back(-1.0+3.0*i/1000);
+  A(x.data(),out.data(),x.size());
+  for(std::size_t i=0;i<x.size();++i){
+    beaver_test::check_same("approximant view",x[i],V(x[i]),A(x[i]));
+    beaver_test::check_same("approximant deserialize",x[i],B(x[i]),A(x[i]));
+    beaver_test::check_same("approximant batch",x[i],out[i],A(x[i]));
+  }
+  check("view metadata",V.pieces()==A.pieces() && V.degree()==A.degree() && V.max_error()==A.max_error());
+
+  //truncated blobs, every length
+  for(std::size_t n=0;n<blob.size();++n){
+    std::vector<unsigned char> cut(blob.begin(),blob.begin()+static_cast<std::ptrdiff_t>(n));
+    if(!rejected(cut)){
+      check("truncated blob rejected",false);
+      break;
+    }
+  }
+  check("null blob rejected",throws_invalid([] { (void)beaver::approximant_view::from_blob(nullptr,64); }));
+
+  //corrupt headers
+  const LOC::header h0=header_of(blob);
+  LOC::header h=h0;
+  h.magic[0]='X';
+  check("bad magic rejected",rejected(with_header(blob,h)));
+  h=h0; h.version=2;
+  check("bad version rejected",rejected(with_header(blob,h)));
+  h=h0; h.ncoef=0;
+  check("ncoef=0 rejected",rejected(with_header(blob,h)));
+  h=h0; h.ncoef=LOC::max_ncoef+1;
+  check("ncoef>max_ncoef rejected",rejected(with_header(blob,h)));
+  h=h0; h.npieces=0;
+  check("npieces=0 rejected",rejected(with_header(blob,h)));
+  h=h0; h.npieces=h0.npieces+1;
+  check("npieces past the end rejected",rejected(with_header(blob,h)));
+  //1+npieces*(ncoef+3) wraps to 1 for ncoef=1, npieces=2^62: must not pass as a one-double body
+  h=h0; h.ncoef=1; h.npieces=std::uint64_t{1}<<62;
+  check("wrapping npieces rejected",rejected(with_header(blob,h)));
+  h=h0; h.ncoef=LOC::max_ncoef; h.npieces=std::numeric_limits<std::uint64_t>::max();
+  check("huge npieces rejected",rejected(with_header(blob,h)));
+  h=h0; h.b=3.0;
+  check("inconsistent range rejected",rejected(with_header(blob,h)));
+  //corrupt body: breakpoints out of order
+  std::vector<unsigned char> swapped=blob;
+  double* sb=reinterpret_cast<double*>(swapped.data()+sizeof(LOC::header));
+  std::swap(sb[1],sb[2]);
+  check("unsorted breakpoints rejected",rejected(swapped));
+  std::vector<unsigned char> nan_break=blob;
+  reinterpret_cast<double*>(nan_break.data()+sizeof(LOC::header))[1]=std::nan("");
+  check("NaN breakpoint rejected",rejected(nan_break));
+  //misaligned: the same bytes one byte further in
+  std::vector<unsigned char> shifted(blob.size()+1);
+  std::memcpy(shifted.data()+1,blob.data(),blob.size());
+  check("misaligned blob rejected",throws_invalid([&] { (void)beaver::approximant_view::from_blob(shifted.data()+1,blob.size()); }));
+
+  //high degrees: the DCT noise in the top Chebyshev coefficients must not reach the monomial form,
+  //where it would be amplified by up to (1+sqrt 2)^degree
+  struct high { double (*fn)(double); double a, b; int degree; double rtol; };
+  const high highs[]={
+    {+[](double t) { return std::exp(t); },0.0,1.0,50,1e-14},
+    {+[](double t) { return std::exp(t); },0.0,1.0,63,1e-12},
+    {+[](double t) { return std::exp(t); },0.0,1.0,63,1e-14},
+    {+[](double t) { return std::sin(t)+2; },0.0,100.0,45,1e-14},
+    {+[](double t) { return std::sin(t)+2; },0.0,100.0,63,1e-14},
+  };
+  for(const high& c : highs){
+    bool built=true;
+    try {
+      const beaver::approximant H=beaver::approximant::build(c.fn,c.a,c.b,c.rtol,{c.degree,0.0,1u<<16,4});
+      for(int i=0;i<=2000;++i){
+        const double t=c.a+(c.b-c.a)*i/2000;
+        beaver_test::check_close("high-degree approximant",t,H(t),c.fn(t),10*c.rtol);
+      }
+    } catch (const std::exception&) {
+      built=false;
+    }
+    check("high-degree approximant builds",built);
+  }
+
+  //build() argument checks and failures
+  check("a>=b rejected",throws_invalid([] { (void)beaver::approximant::build(f,1.0,1.0,1e-10); }));
+  check("zero tolerance rejected",throws_invalid([] { (void)beaver::approximant::build(f,0.0,1.0,0.0); }));
+  check("degree 64 rejected",throws_invalid([] { (void)beaver::approximant::build(f,0.0,1.0,1e-10,{64,0.0,1u<<14,4}); }));
+  check("non-finite f rejected",throws_runtime([] { (void)beaver::approximant::build([](double t) { return 1/t; },-1.0,1.0,1e-10); }));
+  check("max_pieces reached",throws_runtime([] { (void)beaver::approximant::build([](double t) { return std::fabs(t-0.3); },0.0,1.0,1e-15,{4,0.0,8,4}); }));
+  return beaver_test::report("approximant");
+}
@@ -0,0 +1,104 @@
+/* Every symbol of the C ABI called once through libbeaver: scalar forms against reference values
+ * (mpmath), array forms against the scalar forms. */
+#include "beaver_c.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+static void check_close(const char* what, double got, double ref) {
+  const double tol = 4e-15;
+  if (!(fabs(got - ref) <= tol * fabs(ref))) {
+    ++failures;
+    printf("FAIL %s: got %.17g, expected %.17g\n", what, got, ref);
+  }
+}
+
+static void check_same(const char* what, const double* got, const double* ref, size_t n) {
+  if (memcmp(got, ref, n * sizeof(double)) != 0) {
+    ++failures;
+    printf("FAIL %s: array form differs from the scalar form\n", what);
+  }
+}
+
+typedef double (*scalar_fn)(double);
+typedef void (*array_fn)(const double*, double*, size_t);
+
+static void check_real(const char* what, scalar_fn f, array_fn fv, double x, double ref) {
+  double in[3], out[3], scalar[3];
+  size_t i;
+  check_close(what, f(x), ref);
+  in[0] = x; in[1] = 0.5 * x; in[2] = -x;
+  for (i = 0; i < 3; ++i) scalar[i] = f(in[i]);
+  fv(in, out, 3);
+  check_same(what, out, scalar, 3);
+}
+
+typedef void (*cscalar_fn)(const double*, double*);
+typedef void (*carray_fn)(const double*, double*, size_t);
+
+static void check_complex(const char* what, cscalar_fn f, carray_fn fv, const double* z, double re, double im) {
+  double out[2], in[4], vout[4], scalar[4];
+  f(z, out);
+  check_close(what, out[0], re);
+  check_close(what, out[1], im);
+  in[0] = z[0]; in[1] = z[1]; in[2] = z[0]; in[3] = -z[1];
+  f(in, scalar);
+  f(in + 2, scalar + 2);
+  fv(in, vout, 2);
+  check_same(what, vout, scalar, 4);
+}
+
+int main(void) {
+  const double x = 0.25;
+  const double y = 0.75; /* 1-x */
+  const double z[2] = {-2.9, 0.5};
+  double u[2], uv[4], theta[2], in[2], out[2], scalar[2];
+
+  if (beaver_version() == NULL || beaver_version()[0] == '\0') {
+    ++failures;
+    printf("FAIL beaver_version\n");
+  }
+
+  check_real("beaver_log", beaver_log, beaver_log_v, x, -1.3862943611198906188);
+  check_real("beaver_log1p", beaver_log1p, beaver_log1p_v, x, 0.22314355131420975577);
+  check_real("beaver_arctan", beaver_arctan, beaver_arctan_v, x, 0.24497866312686415417);
+  check_real("beaver_atanint", beaver_atanint, beaver_atanint_v, x, 0.24830175098230686908);
+  check_real("beaver_dilog", beaver_dilog, beaver_dilog_v, x, 0.26765263908273260692);
+  check_real("beaver_trilog", beaver_trilog, beaver_trilog_v, x, 0.25846139579657330529);
+  check_real("beaver_svdilog", beaver_svdilog, beaver_svdilog_v, x, 0.46705865650032646982);
+  check_real("beaver_clausen2", beaver_clausen2, beaver_clausen2_v, x, 0.59679067203380181884);
+  check_real("beaver_log1m", beaver_log1m, beaver_log1m_v, y, -1.3862943611198906188);
+  check_real("beaver_dilog_1m", beaver_dilog_1m, beaver_dilog_1m_v, y, 0.26765263908273260692);
+  check_real("beaver_trilog_1m", beaver_trilog_1m, beaver_trilog_1m_v, y, 0.25846139579657330529);
+  check_real("beaver_svdilog_1m", beaver_svdilog_1m, beaver_svdilog_1m_v, y, 0.46705865650032646982);
+
+  check_close("beaver_pow", beaver_pow(x, 5), 0.0009765625);
+  in[0] = x; in[1] = -3.0;
+  scalar[0] = beaver_pow(in[0], 5); scalar[1] = beaver_pow(in[1], 5);
+  beaver_pow_v(in, out, 2, 5);
+  check_same("beaver_pow_v", out, scalar, 2);
+
+  beaver_li2_unit_circle(x, u);
+  check_close("beaver_li2_unit_circle", u[0], 1.26785998514950228166);
+  check_close("beaver_li2_unit_circle", u[1], 0.59679067203380181884);
+  theta[0] = x; theta[1] = -x;
+  beaver_li2_unit_circle_v(theta, uv, 2);
+  check_same("beaver_li2_unit_circle_v", uv, u, 2);
+  if (uv[2] != u[0] || uv[3] != -u[1]) {
+    ++failures;
+    printf("FAIL beaver_li2_unit_circle_v: conjugate at -theta\n");
+  }
+
+  check_complex("beaver_cdilog", beaver_cdilog, beaver_cdilog_v, z, -1.9019393570513473584, 0.23407253725944682501);
+  check_complex("beaver_ctrilog", beaver_ctrilog, beaver_ctrilog_v, z, -2.2917151999945207258, 0.32596670646578519125);
+  check_complex("beaver_csvdilog", beaver_csvdilog, beaver_csvdilog_v, z, -1.1630501527330853119, 0.096444156965354227059);
+
+  if (failures != 0) {
+    printf("capi: %d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("capi: all checks passed\n");
+  return 0;
+}
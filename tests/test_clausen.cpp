@@ -0,0 +1,101 @@
+// Cl2(theta) and Li2(e^{i theta}) against reference values (mpmath, 50 digits),
+// and the array forms against the scalar functions.
+#include "beaver.hpp"
+#include "check.hpp"
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace {
+  struct point { double theta, re, im; };
+  //{theta, Re Li2(e^{i theta}), Cl2(theta)}
+  const point points[]={
+    {1e-300, 1.6449340668482264365, 6.9177552789821372252e-298},
+    {1e-12, 1.6449340668466556401, 2.8631021115928547652e-11},
+    {1e-06, 1.6449324960521496416, 0.000014815510557964287368},
+    {0.001, 1.6433635205214315398, 0.0079077552928710261542},
+    {0.1, 1.4903544341687367661, 0.3302723988828166612},
+    {0.5, 0.92203590345077812686, 0.84831187770367927099},
+    {1.0, 0.32413774005332981724, 1.0139591323607685043},
+    {1.5, -0.14876042334411849237, 0.93921859275409211003},
+    {2.0, -0.49665858674156680199, 0.72714605086327924743},
+    {2.0943951023931953, -0.54831135561607535857, 0.67662773760643587617},
+    {2.1, -0.55123821942105651017, 0.67354440833987191173},
+    {2.5, -0.71955675013901511161, 0.43359820323553277936},
+    {3.0, -0.81745491353646342122, 0.098026209391301421161},
+    {3.1, -0.82203454621595308499, 0.028826832389660663869},
+    {3.141592653589793, -0.82246703342411321824, 8.4886047601074949013e-17},
+    {3.2, -0.82161417889544273988, -0.040476584618405392957},
+    {4.0, -0.63825124033136004045, -0.5681439444298697808},
+    {5.0, 0.040952432873743340316, -0.99282013254695671871},
+    {6.0, 1.2201561060788467211, -0.64078266570172320959},
+    {6.283, 1.644642995595891547, -0.0017777436268616203789},
+    {-0.7, 0.66787663809179885722, -0.95444808648273501604},
+    {-2.5, -0.71955675013901511161, -0.43359820323553277936},
+    {10.0, -0.7397469348199549028, -0.39071647608680211043},
+    {100.0, 0.88137726411477533965, -0.86917920033571799073},
+    {12345.678, 0.5704805943391448305, -0.98071944747481666375},
+    //theta=(2k+1)pi+-delta, delta in {1e-6,1e-10,1e-13}, for k=0,1,-1: Cl2 ~ delta log 2 has to keep its
+    //relative accuracy on both sides of the odd multiple of pi
+    {3.1415936535897933, -0.82246703342386321824, -6.9314718057190429887e-7},
+    {3.141591653589793, -0.82246703342386321824, 6.9314718074167639407e-7},
+    {3.141592653689793, -0.82246703342411321823, -6.9314638905072417517e-11},
+    {3.141592653489793, -0.82246703342411321823, 6.9314808677167619667e-11},
+    {3.141592653589893, -0.82246703342411321824, -6.917443029044850398e-14},
+    {3.141592653589693, -0.82246703342411321824, 6.9344202385650653878e-14},
+    {9.424778960769379, -0.82246703342386321824, -6.9314717978649383621e-7},
+    {9.42477696076938, -0.82246703342386321824, 6.9314718029581012182e-7},
+    {9.42477796086938, -0.82246703342411321823, -6.9314469132977215367e-11},
+    {9.42477796066938, -0.82246703342411321823, 6.9314978449262821817e-11},
+    {9.424777960769479, -0.82246703342411321824, -6.8696839011521689287e-14},
+    {9.42477796076928, -0.82246703342411321824, 6.9206155297128138981e-14},
+    {-3.141591653589793, -0.82246703342386321824, -6.9314718074167639407e-7},
+    {-3.1415936535897933, -0.82246703342386321824, 6.9314718057190429887e-7},
+    {-3.141592653489793, -0.82246703342411321823, -6.9314808677167619667e-11},
+    {-3.141592653689793, -0.82246703342411321823, 6.9314638905072417517e-11},
+    {-3.141592653589693, -0.82246703342411321824, -6.9344202385650653878e-14},
+    {-3.141592653589893, -0.82246703342411321824, 6.917443029044850398e-14},
+  };
+  //relative accuracy of both functions, also where Cl2 vanishes; the reduction error of 2pi*n is part
+  //of it for large theta
+  const double tol=2e-15;
+  const double pi=3.141592653589793;
+}
+
+int main() {
+  using beaver_test::check_close;
+  using beaver_test::check_same;
+  for(const point& p : points){
+    check_close("clausen2",p.theta,beaver::clausen2(p.theta),p.im,tol);
+    const std::complex<double> li2=beaver::li2_unit_circle(p.theta);
+    check_close("Re li2_unit_circle",p.theta,li2.real(),p.re,tol);
+    check_close("Im li2_unit_circle",p.theta,li2.imag(),p.im,tol);
+  }
+  //Cl2 is odd and 2pi periodic, Cl2(0)=0
+  check_same("clausen2",0.0,beaver::clausen2(0.0),0.0);
+  check_same("clausen2",-1.0,beaver::clausen2(-1.0),-beaver::clausen2(1.0));
+  check_close("clausen2",1.0+2*pi,beaver::clausen2(1.0+2*pi),beaver::clausen2(1.0),tol);
+  const double nan=std::numeric_limits<double>::quiet_NaN();
+  const double inf=std::numeric_limits<double>::infinity();
+  check_same("clausen2",inf,beaver::clausen2(inf),nan);
+  check_same("clausen2",nan,beaver::clausen2(nan),nan);
+  check_same("Re li2_unit_circle",inf,beaver::li2_unit_circle(inf).real(),nan);
+
+  //array forms: same results as the scalar calls
+  std::vector<double> theta;
+  for(const point& p : points) theta.push_back(p.theta);
+  theta.push_back(0.0);
+  theta.push_back(nan);
+  const std::size_t n=theta.size();
+  std::vector<double> cl(n);
+  std::vector<std::complex<double>> li(n);
+  beaver::clausen2(theta.data(),cl.data(),n);
+  beaver::li2_unit_circle(theta.data(),li.data(),n);
+  for(std::size_t i=0;i<n;++i){
+    check_same("clausen2 array",theta[i],cl[i],beaver::clausen2(theta[i]));
+    check_same("Re li2_unit_circle array",theta[i],li[i].real(),beaver::li2_unit_circle(theta[i]).real());
+    check_same("Im li2_unit_circle array",theta[i],li[i].imag(),beaver::li2_unit_circle(theta[i]).imag());
+  }
+  return beaver_test::report("clausen");
+}
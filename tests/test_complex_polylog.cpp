@@ -0,0 +1,204 @@
+// Complex Li2 and Li3 against reference values (mpmath, 240 digits) on the real axis, on both sides
+// of the branch cut x>1 (signed zero imaginary part), in the strip just off the axis and at generic points.
+// Near the axis the real and imaginary parts are checked separately with relative error:
+// Im Li_n(x+iy) is proportional to y there and must not lose digits as y->0.
+#include "beaver.hpp"
+#include "check.hpp"
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace {
+  struct point { double x, y, li2re, li2im, li3re, li3im; };
+  const point points[]={
+    {-50.0, 0.001, -9.2769951859229085352, 0.000078636512647897586177, -16.433187330440072621, 0.00018553990369633389983},
+    {-50.0, -0.001, -9.2769951859229085352, -0.000078636512647897586177, -16.433187330440072621, -0.00018553990369633389983},
+    {-50.0, 1.5e-09, -9.2769951853326218401, 1.1795476898172977236e-10, -16.43318732937103871, 2.7830985555997865335e-10},
+    {-50.0, -1.5e-09, -9.2769951853326218401, -1.1795476898172977236e-10, -16.43318732937103871, -2.7830985555997865335e-10},
+    {-50.0, 1.3e-11, -9.2769951853326218401, 1.0222746645083247277e-12, -16.43318732937103871, 2.4120187481864817423e-12},
+    {-50.0, -1.3e-11, -9.2769951853326218401, -1.0222746645083247277e-12, -16.43318732937103871, -2.4120187481864817423e-12},
+    {-50.0, 1e-14, -9.2769951853326218401, 7.863651265448651534e-16, -16.43318732937103871, 1.8553990370665243658e-15},
+    {-50.0, -1e-14, -9.2769951853326218401, -7.863651265448651534e-16, -16.43318732937103871, -1.8553990370665243658e-15},
+    {-50.0, 1e-200, -9.2769951853326218401, 7.8636512654486514025e-202, -16.43318732937103871, 1.8553990370665243348e-201},
+    {-50.0, -1e-200, -9.2769951853326218401, -7.8636512654486514025e-202, -16.43318732937103871, -1.8553990370665243348e-201},
+    {-2.9, 0.001, -1.892807697990874162, 0.00046930225504239972776, -2.283834534660564713, 0.000652692293945246658},
+    {-2.9, -0.001, -1.892807697990874162, -0.00046930225504239972776, -2.283834534660564713, -0.000652692293945246658},
+    {-2.9, 1.5e-09, -1.8928076612853570738, 7.0395338955289694134e-10, -2.2838345030415931531, 9.7903844549242609609e-10},
+    {-2.9, -1.5e-09, -1.8928076612853570738, -7.0395338955289694134e-10, -2.2838345030415931531, -9.7903844549242609609e-10},
+    {-2.9, 1.3e-11, -1.8928076612853570738, 6.1009293761251070273e-12, -2.283834503041593153, 8.4849998609343597808e-12},
+    {-2.9, -1.3e-11, -1.8928076612853570738, -6.1009293761251070273e-12, -2.283834503041593153, -8.4849998609343597808e-12},
+    {-2.9, 1e-14, -1.8928076612853570738, 4.693022597019312968e-15, -2.283834503041593153, 6.5269229699495073431e-15},
+    {-2.9, -1e-14, -1.8928076612853570738, -4.693022597019312968e-15, -2.283834503041593153, -6.5269229699495073431e-15},
+    {-2.9, 1e-200, -1.8928076612853570738, 4.6930225970193128896e-201, -2.283834503041593153, 6.5269229699495072339e-201},
+    {-2.9, -1e-200, -1.8928076612853570738, -4.6930225970193128896e-201, -2.283834503041593153, -6.5269229699495072339e-201},
+    {-1.0, 0.001, -0.82246712999769687808, 0.00069314715784422064163, -0.9015427420296196385, 0.00082246702250869305604},
+    {-1.0, -0.001, -0.82246712999769687808, -0.00069314715784422064163, -0.9015427420296196385, -0.00082246702250869305604},
+    {-1.0, 1.5e-09, -0.82246703342411321845, 1.0397207708399179571e-9, -0.9015426773696957142, 1.2337005501361698191e-9},
+    {-1.0, -1.5e-09, -0.82246703342411321845, -1.0397207708399179571e-9, -0.9015426773696957142, -1.2337005501361698191e-9},
+    {-1.0, 1.3e-11, -0.82246703342411321824, 9.0109133472792892611e-12, -0.90154267736969571405, 1.069207143451347212e-11},
+    {-1.0, -1.3e-11, -0.82246703342411321824, -9.0109133472792892611e-12, -0.90154267736969571405, -1.069207143451347212e-11},
+    {-1.0, 1e-14, -0.82246703342411321824, 6.931471805599453086e-15, -0.90154267736969571405, 8.2246703342411321727e-15},
+    {-1.0, -1e-14, -0.82246703342411321824, -6.931471805599453086e-15, -0.90154267736969571405, -8.2246703342411321727e-15},
+    {-1.0, 1e-200, -0.82246703342411321824, 6.9314718055994529701e-201, -0.90154267736969571405, 8.2246703342411320351e-201},
+    {-1.0, -1e-200, -0.82246703342411321824, -6.9314718055994529701e-201, -0.90154267736969571405, -8.2246703342411320351e-201},
+    {-0.7, 0.001, -0.60515852362702580358, 0.00075804032553249395541, -0.64866639733640633648, 0.00086451198866671464544},
+    {-0.7, -0.001, -0.60515852362702580358, -0.00075804032553249395541, -0.64866639733640633648, -0.00086451198866671464544},
+    {-0.7, 1.5e-09, -0.60515840233770525058, 1.1370605379903651433e-9, -0.64866632128523545529, 1.2967680050093684671e-9},
+    {-0.7, -1.5e-09, -0.60515840233770525058, -1.1370605379903651433e-9, -0.64866632128523545529, -1.2967680050093684671e-9},
+    {-0.7, 1.3e-11, -0.60515840233770525031, 9.8545246625831649025e-12, -0.64866632128523545511, 1.1238656043414527088e-11},
+    {-0.7, -1.3e-11, -0.60515840233770525031, -9.8545246625831649025e-12, -0.64866632128523545511, -1.1238656043414527088e-11},
+    {-0.7, 1e-14, -0.60515840233770525031, 7.5804035866024343307e-15, -0.64866632128523545511, 8.6451200333957898284e-15},
+    {-0.7, -1e-14, -0.60515840233770525031, -7.5804035866024343307e-15, -0.64866632128523545511, -8.6451200333957898284e-15},
+    {-0.7, 1e-200, -0.60515840233770525031, 7.5804035866024342039e-201, -0.64866632128523545511, 8.6451200333957896839e-201},
+    {-0.7, -1e-200, -0.60515840233770525031, -7.5804035866024342039e-201, -0.64866632128523545511, -8.6451200333957896839e-201},
+    {0.3, 0.001, 0.326129110650755838, 0.0011889162336200236649, 0.31240000819607620606, 0.0010870983002169418801},
+    {0.3, -0.001, 0.326129110650755838, -0.0011889162336200236649, 0.31240000819607620606, -0.0010870983002169418801},
+    {0.3, 1.5e-09, 0.32612951007547605543, 1.7833747196936618686e-9, 0.31240017789289260831, 1.6306475503773803309e-9},
+    {0.3, -1.5e-09, 0.32612951007547605543, -1.7833747196936618686e-9, 0.31240017789289260831, -1.6306475503773803309e-9},
+    {0.3, 1.3e-11, 0.32612951007547605633, 1.5455914237345070047e-11, 0.31240017789289260869, 1.4132278769937296672e-11},
+    {0.3, -1.3e-11, 0.32612951007547605633, -1.5455914237345070047e-11, 0.31240017789289260869, -1.4132278769937296672e-11},
+    {0.3, 1e-14, 0.32612951007547605633, 1.1889164797957745861e-14, 0.31240017789289260869, 1.08709836691825356e-14},
+    {0.3, -1e-14, 0.32612951007547605633, -1.1889164797957745861e-14, 0.31240017789289260869, -1.08709836691825356e-14},
+    {0.3, 1e-200, 0.32612951007547605633, 1.1889164797957745662e-200, 0.31240017789289260869, 1.0870983669182535419e-200},
+    {0.3, -1e-200, 0.32612951007547605633, -1.1889164797957745662e-200, 0.31240017789289260869, -1.0870983669182535419e-200},
+    {0.8, 0.001, 1.0747927323912145425, 0.0020117937385942831392, 0.91060543771649199172, 0.0013434928199092820699},
+    {0.8, -0.001, 1.0747927323912145425, -0.0020117937385942831392, 0.91060543771649199172, -0.0013434928199092820699},
+    {0.8, 1.5e-09, 1.0747946000082484445, 3.0176960858139384188e-9, 0.9106058554058418061, 2.0152398750154657147e-9},
+    {0.8, -1.5e-09, 1.0747946000082484445, -3.0176960858139384188e-9, 0.9106058554058418061, -2.0152398750154657147e-9},
+    {0.8, 1.3e-11, 1.0747946000082484487, 2.6153366077054133936e-11, 0.91060585540584180704, 1.7465412250134036785e-11},
+    {0.8, -1.3e-11, 1.0747946000082484487, -2.6153366077054133936e-11, 0.91060585540584180704, -1.7465412250134036785e-11},
+    {0.8, 1e-14, 1.0747946000082484487, 2.0117973905426256318e-14, 0.91060585540584180704, 1.3434932500103104848e-14},
+    {0.8, -1e-14, 1.0747946000082484487, -2.0117973905426256318e-14, 0.91060585540584180704, -1.3434932500103104848e-14},
+    {0.8, 1e-200, 1.0747946000082484487, 2.0117973905426255981e-200, 0.91060585540584180704, 1.3434932500103104623e-200},
+    {0.8, -1e-200, 1.0747946000082484487, -2.0117973905426255981e-200, 0.91060585540584180704, -1.3434932500103104623e-200},
+    {0.999, 0.001, 1.6365867056775252129, 0.0067828498277161498759, 1.2004127486328662278, 0.0016385104011724712035},
+    {0.999, -0.001, 1.6365867056775252129, -0.0067828498277161498759, 1.2004127486328662278, -0.0016385104011724712035},
+    {0.999, 1.5e-09, 1.6370226052761166182, 1.0372004923396038843e-8, 1.2004153539954643378, 2.4579918998139900275e-9},
+    {0.999, -1.5e-09, 1.6370226052761166182, -1.0372004923396038843e-8, 1.2004153539954643378, -2.4579918998139900275e-9},
+    {0.999, 1.3e-11, 1.6370226052761177365, 8.98907093361038761e-11, 1.2004153539954643437, 2.1302596465054585743e-11},
+    {0.999, -1.3e-11, 1.6370226052761177365, -8.98907093361038761e-11, 1.2004153539954643437, -2.1302596465054585743e-11},
+    {0.999, 1e-14, 1.6370226052761177366, 6.9146699489310672291e-14, 1.2004153539954643437, 1.6386612665426603965e-14},
+    {0.999, -1e-14, 1.6370226052761177366, -6.9146699489310672291e-14, 1.2004153539954643437, -1.6386612665426603965e-14},
+    {0.999, 1e-200, 1.6370226052761177366, 6.9146699489310671135e-200, 1.2004153539954643437, 1.6386612665426603691e-200},
+    {0.999, -1e-200, 1.6370226052761177366, -6.9146699489310671135e-200, 1.2004153539954643437, -1.6386612665426603691e-200},
+    {1.001, 0.001, 1.6501414040808937058, 0.009910318025101479565, 1.2036994900071761005, 0.0016513460351342339965},
+    {1.001, -0.001, 1.6501414040808937058, -0.009910318025101479565, 1.2036994900071761005, -0.0016513460351342339965},
+    {1.001, 1.5e-09, 1.6528381159537963406, 0.0031400332549570738827, 1.2037052151466502123, 1.5717037494536545684e-6},
+    {1.001, -1.5e-09, 1.6528381159537963406, -0.0031400332549570738827, 1.2037052151466502123, -1.5717037494536545684e-6},
+    {1.001, 1.3e-11, 1.6528381206206766036, 0.003140022993386541039, 1.2037052151513147677, 1.5692484344867248488e-6},
+    {1.001, -1.3e-11, 1.6528381206206766036, -0.003140022993386541039, 1.2037052151513147677, -1.5692484344867248488e-6},
+    {1.001, 1e-14, 1.6528381206614451236, 0.0031400229037444420638, 1.2037052151513555158, 1.56922698556845599e-6},
+    {1.001, -1e-14, 1.6528381206614451236, -0.0031400229037444420638, 1.2037052151513555158, -1.56922698556845599e-6},
+    {1.001, 1e-200, 1.6528381206614765081, 0.0031400229036754335195, 1.2037052151513555472, 1.5692269690565866527e-6},
+    {1.001, -1e-200, 1.6528381206614765081, -0.0031400229036754335195, 1.2037052151513555472, -1.5692269690565866527e-6},
+    {1.5, 0.001, 2.372301696178892093, 1.2742690003623207498, 2.0600286764548844629, 0.25982450042636437915},
+    {1.5, -0.001, 2.372301696178892093, -1.2742690003623207498, 2.0600286764548844629, -0.25982450042636437915},
+    {1.5, 1.5e-09, 2.3743952671308875489, 1.2738062056127477131, 2.0608775060464746672, 0.25824198766768348009},
+    {1.5, -1.5e-09, 2.3743952671308875489, -1.2738062056127477131, 2.0608775060464746672, -0.25824198766768348009},
+    {1.5, 1.3e-11, 2.3743952702452530643, 1.2738062049256078065, 2.0608775073092412175, 0.2582419853138663031},
+    {1.5, -1.3e-11, 2.3743952702452530643, -1.2738062049256078065, 2.0608775073092412175, -0.2582419853138663031},
+    {1.5, 1e-14, 2.3743952702724592567, 1.2738062049196051519, 2.0608775073202723792, 0.25824198529330404006},
+    {1.5, -1e-14, 2.3743952702724592567, -1.2738062049196051519, 2.0608775073202723792, -0.25824198529330404006},
+    {1.5, 1e-200, 2.3743952702724802007, 1.2738062049196005309, 2.0608775073202808713, 0.25824198529328821075},
+    {1.5, -1e-200, 2.3743952702724802007, -1.2738062049196005309, 2.0608775073202808713, -0.25824198529328821075},
+    {7.0, 0.001, 1.2478243767734666382, 6.1130010952365443348, 5.3183847007350895343, 5.9481028031404777587},
+    {7.0, -0.001, 1.2478243767734666382, -6.1130010952365443348, 5.3183847007350895343, -5.9481028031404777587},
+    {7.0, 1.5e-09, 1.2482731814262260322, 6.1132570284340433609, 5.3192579908356917892, 5.9479244483478172128},
+    {7.0, -1.5e-09, 1.2482731814262260322, -6.1132570284340433609, 5.3192579908356917892, -5.9479244483478172128},
+    {7.0, 1.3e-11, 1.2482731820935900716, 6.1132570288146642652, 5.3192579921343222465, 5.9479244480826483239},
+    {7.0, -1.3e-11, 1.2482731820935900716, -6.1132570288146642652, 5.3192579921343222465, -5.9479244480826483239},
+    {7.0, 1e-14, 1.24827318209941997, 6.1132570288179892588, 5.3192579921456667049, 5.9479244480803318856},
+    {7.0, -1e-14, 1.24827318209941997, -6.1132570288179892588, 5.3192579921456667049, -5.9479244480803318856},
+    {7.0, 1e-200, 1.2482731820994244579, 6.1132570288179918185, 5.3192579921456754382, 5.9479244480803301023},
+    {7.0, -1e-200, 1.2482731820994244579, -6.1132570288179918185, 5.3192579921456754382, -5.9479244480803301023},
+    {40.0, 0.001, -3.5392842313588943368, 11.588865004963274536, 3.7944408671770951277, 21.375043457807309042},
+    {40.0, -0.001, -3.5392842313588943368, -11.588865004963274536, 3.7944408671770951277, -21.375043457807309042},
+    {40.0, 1.5e-09, -3.5392056908360304852, 11.588956592885285512, 3.7947305906184377708, 21.375131935177063071},
+    {40.0, -1.5e-09, -3.5392056908360304852, -11.588956592885285512, 3.7947305906184377708, -21.375131935177063071},
+    {40.0, 1.3e-11, -3.5392056907192417783, 11.588956593021478416, 3.7947305910492572322, 21.375131935308633043},
+    {40.0, -1.3e-11, -3.5392056907192417783, -11.588956593021478416, 3.7947305910492572322, -21.375131935308633043},
+    {40.0, 1e-14, -3.5392056907182215461, 11.588956593022668158, 3.7947305910530207458, 21.3751319353097824},
+    {40.0, -1e-14, -3.5392056907182215461, -11.588956593022668158, 3.7947305910530207458, -21.3751319353097824},
+    {40.0, 1e-200, -3.5392056907182207607, 11.588956593022669073, 3.7947305910530236431, 21.375131935309783285},
+    {40.0, -1e-200, -3.5392056907182207607, -11.588956593022669073, 3.7947305910530236431, -21.375131935309783285},
+    {1.5, 0.0, 2.3743952702724802007, 1.2738062049196005309, 2.0608775073202808713, 0.25824198529328821075},
+    {1.5, -0.0, 2.3743952702724802007, -1.2738062049196005309, 2.0608775073202808713, -0.25824198529328821075},
+    {2.0, 0.0, 2.4674011002723396547, 2.1775860903036021305, 2.7620719062289241359, 0.75469382946024813886},
+    {2.0, -0.0, 2.4674011002723396547, -2.1775860903036021305, 2.7620719062289241359, -0.75469382946024813886},
+    {7.0, 0.0, 1.2482731820994244579, 6.1132570288179918185, 5.3192579921456754382, 5.9479244480803301023},
+    {7.0, -0.0, 1.2482731820994244579, -6.1132570288179918185, 5.3192579921456754382, -5.9479244480803301023},
+    {40.0, 0.0, -3.5392056907182207607, 11.588956593022669073, 3.7947305910530236431, 21.375131935309783285},
+    {40.0, -0.0, -3.5392056907182207607, -11.588956593022669073, 3.7947305910530236431, -21.375131935309783285},
+    {100000.0, 0.0, -62.98386824730852237, 36.168922062077324062, -216.45880742384405228, 208.20505192450676452},
+    {100000.0, -0.0, -62.98386824730852237, -36.168922062077324062, -216.45880742384405228, -208.20505192450676452},
+    {-100000.0, 0.0, -67.918650447853201457, 0.0, -273.27283734308601079, 0.0},
+    {-50.0, 0.0, -9.2769951853326218401, 0.0, -16.43318732937103871, 0.0},
+    {-1.0, 0.0, -0.82246703342411321824, 0.0, -0.90154267736969571405, 0.0},
+    {0.3, 0.0, 0.32612951007547605633, 0.0, 0.31240017789289260869, 0.0},
+    {0.5, 0.0, 0.5822405264650125059, 0.0, 0.53721319360804020094, 0.0},
+    {1.0, 0.0, 1.6449340668482264365, 0.0, 1.2020569031595942854, 0.0},
+    {0.5, 0.5, 0.45398526915029558331, 0.64376733288926874874, 0.48615953708556007897, 0.5700774070887689782},
+    {-0.3, 0.9, -0.40762768541956664547, 0.7487522726891895306, -0.36477911965210655206, 0.82461751998063609693},
+    {0.9, 0.4, 1.018274783210708985, 0.7633582459821352899, 0.97891802599959916125, 0.54489144420478309102},
+    {1.2, -0.3, 1.541121979857292493, -0.98047862536500386134, 1.4157585950920146354, -0.52130599038499009054},
+    {-3.0, 2.0, -2.0713071652315143212, 0.89227316790070348577, -2.466410148606689071, 1.2712148255191350879},
+    {2.5, 7.0, -1.866987750583901784, 3.9684010746436387218, -0.92786840599326402954, 5.7021236076138764538},
+    {0.0, 1.0, -0.20561675835602830456, 0.91596559417721901505, -0.11269283467121196426, 0.96894614625936938048},
+    {0.6, -0.8, 0.4033112498889853879, -1.0084130373169354043, 0.52212170253849540313, -0.91644073985354030951},
+    {10.0, -0.01, 0.53315915269473964922, -7.2315887587899465694, 5.6345789979414649247, -8.3287404232709457949},
+    {-0.25, -0.001, -0.23590048283464344689, -0.00089257413819442675114, -0.24271210539287850588, -0.00094360116546568224842},
+    {0.5, 0.8660254037844386, 0.27415567780803776568, 1.0149416064096535795, 0.40068563438653144202, 0.95698384815740180629},
+    {1e-08, 1e-08, 9.999999999999999987e-9, 1.0000000050000000431e-8, 1.0000000000000000135e-8, 1.0000000025000000283e-8},
+    {-1000000.0, 3.0, -97.079099055517310433, 0.000041446534673780482691, -462.21618090346220303, 0.0002912372971656872194},
+  };
+  //component-wise relative accuracy for |Im z|<=1e-3, normwise elsewhere
+  const double tol_strip=4e-15;
+  const double tol_norm=1e-14;
+
+  void check_point(const char* name, std::complex<double> z, std::complex<double> got, double re, double im) {
+    using beaver_test::check_close;
+    if(std::fabs(z.imag())<=1e-3){
+      check_close(name,z,got.real(),re,tol_strip);
+      if(im==0){
+        beaver_test::check(name,got.imag()==0);
+      }else{
+        check_close(name,z,got.imag(),im,tol_strip);
+      }
+    }else{
+      const double norm=std::hypot(re,im);
+      check_close(name,z,got.real(),re,tol_norm,norm);
+      check_close(name,z,got.imag(),im,tol_norm,norm);
+    }
+  }
+}
+
+int main() {
+  for(const point& p : points){
+    const std::complex<double> z(p.x,p.y);
+    check_point("dilog",z,beaver::dilog(z),p.li2re,p.li2im);
+    check_point("trilog",z,beaver::trilog(z),p.li3re,p.li3im);
+  }
+  //the real axis below 1 agrees with the real functions
+  for(double x : {-1e5,-50.0,-1.0,0.3,0.5,1.0}){
+    beaver_test::check_same("dilog",x,beaver::dilog(std::complex<double>(x,0.0)).real(),beaver::dilog(x));
+    beaver_test::check_same("trilog",x,beaver::trilog(std::complex<double>(x,0.0)).real(),beaver::trilog(x));
+  }
+  const double nan=std::numeric_limits<double>::quiet_NaN();
+  const double inf=std::numeric_limits<double>::infinity();
+  beaver_test::check("dilog(inf)",std::isnan(beaver::dilog(std::complex<double>(inf,0.0)).real()));
+  beaver_test::check("trilog(nan)",std::isnan(beaver::trilog(std::complex<double>(0.5,nan)).imag()));
+
+  //array forms: same results as the scalar calls
+  std::vector<std::complex<double>> z;
+  for(const point& p : points) z.emplace_back(p.x,p.y);
+  const std::size_t n=z.size();
+  std::vector<std::complex<double>> li2(n), li3(n);
+  beaver::dilog(z.data(),li2.data(),n);
+  beaver::trilog(z.data(),li3.data(),n);
+  for(std::size_t i=0;i<n;++i){
+    beaver_test::check("dilog array",li2[i]==beaver::dilog(z[i]));
+    beaver_test::check("trilog array",li3[i]==beaver::trilog(z[i]));
+  }
+  return beaver_test::report("complex_polylog");
+}
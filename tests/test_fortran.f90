@@ -0,0 +1,118 @@
+! Every generic of the Fortran module called once, scalar forms against reference values (mpmath),
+! rank-1 array forms against the scalar forms, also when called from pure code.
+program test_fortran
+  use, intrinsic :: iso_c_binding, only: c_double, c_double_complex, c_int
+  use beaver
+  implicit none
+  integer :: failures = 0
+  real(c_double), parameter :: x = 0.25_c_double, y = 0.75_c_double
+  real(c_double), parameter :: xs(3) = [0.25_c_double, 0.125_c_double, 0.625_c_double]
+  complex(c_double_complex), parameter :: z = (-2.9_c_double, 0.5_c_double)
+  complex(c_double_complex) :: zs(2)
+  integer :: i
+
+  call close_r('beaver_log', beaver_log(x), -1.3862943611198906188_c_double)
+  call same_r('beaver_log', beaver_log(xs), [(beaver_log(xs(i)), i = 1, 3)])
+  call close_r('beaver_log1p', beaver_log1p(x), 0.22314355131420975577_c_double)
+  call same_r('beaver_log1p', beaver_log1p(xs), [(beaver_log1p(xs(i)), i = 1, 3)])
+  call close_r('beaver_arctan', beaver_arctan(x), 0.24497866312686415417_c_double)
+  call same_r('beaver_arctan', beaver_arctan(xs), [(beaver_arctan(xs(i)), i = 1, 3)])
+  call close_r('beaver_atanint', beaver_atanint(x), 0.24830175098230686908_c_double)
+  call same_r('beaver_atanint', beaver_atanint(xs), [(beaver_atanint(xs(i)), i = 1, 3)])
+  call close_r('beaver_dilog', beaver_dilog(x), 0.26765263908273260692_c_double)
+  call same_r('beaver_dilog', beaver_dilog(xs), [(beaver_dilog(xs(i)), i = 1, 3)])
+  call close_r('beaver_trilog', beaver_trilog(x), 0.25846139579657330529_c_double)
+  call same_r('beaver_trilog', beaver_trilog(xs), [(beaver_trilog(xs(i)), i = 1, 3)])
+  call close_r('beaver_svdilog', beaver_svdilog(x), 0.46705865650032646982_c_double)
+  call same_r('beaver_svdilog', beaver_svdilog(xs), [(beaver_svdilog(xs(i)), i = 1, 3)])
+  call close_r('beaver_clausen2', beaver_clausen2(x), 0.59679067203380181884_c_double)
+  call same_r('beaver_clausen2', beaver_clausen2(xs), [(beaver_clausen2(xs(i)), i = 1, 3)])
+  call close_r('beaver_log1m', beaver_log1m(y), -1.3862943611198906188_c_double)
+  call same_r('beaver_log1m', beaver_log1m(1 - xs), [(beaver_log1m(1 - xs(i)), i = 1, 3)])
+  call close_r('beaver_dilog_1m', beaver_dilog_1m(y), 0.26765263908273260692_c_double)
+  call same_r('beaver_dilog_1m', beaver_dilog_1m(1 - xs), [(beaver_dilog_1m(1 - xs(i)), i = 1, 3)])
+  call close_r('beaver_trilog_1m', beaver_trilog_1m(y), 0.25846139579657330529_c_double)
+  call same_r('beaver_trilog_1m', beaver_trilog_1m(1 - xs), [(beaver_trilog_1m(1 - xs(i)), i = 1, 3)])
+  call close_r('beaver_svdilog_1m', beaver_svdilog_1m(y), 0.46705865650032646982_c_double)
+  call same_r('beaver_svdilog_1m', beaver_svdilog_1m(1 - xs), [(beaver_svdilog_1m(1 - xs(i)), i = 1, 3)])
+  call close_r('beaver_pow', beaver_pow(x, 5_c_int), 0.0009765625_c_double)
+  call same_r('beaver_pow', beaver_pow(xs, 5_c_int), [(beaver_pow(xs(i), 5_c_int), i = 1, 3)])
+
+  call close_c('beaver_li2_unit_circle', beaver_li2_unit_circle(x), &
+               (1.26785998514950228166_c_double, 0.59679067203380181884_c_double))
+  call same_c('beaver_li2_unit_circle', beaver_li2_unit_circle(xs), [(beaver_li2_unit_circle(xs(i)), i = 1, 3)])
+  zs = [z, conjg(z)]
+  call close_c('beaver_dilog', beaver_dilog(z), (-1.9019393570513473584_c_double, 0.23407253725944682501_c_double))
+  call same_c('beaver_dilog', beaver_dilog(zs), [(beaver_dilog(zs(i)), i = 1, 2)])
+  call close_c('beaver_trilog', beaver_trilog(z), (-2.2917151999945207258_c_double, 0.32596670646578519125_c_double))
+  call same_c('beaver_trilog', beaver_trilog(zs), [(beaver_trilog(zs(i)), i = 1, 2)])
+  call close_c('beaver_svdilog', beaver_svdilog(z), (-1.1630501527330853119_c_double, 0.096444156965354227059_c_double))
+  call same_c('beaver_svdilog', beaver_svdilog(zs), [(beaver_svdilog(zs(i)), i = 1, 2)])
+
+  call same_r('pure array forms', array_forms(xs), &
+              [(beaver_log(xs(i)) + beaver_log1p(xs(i)) + beaver_arctan(xs(i)) + beaver_atanint(xs(i)) &
+                + beaver_dilog(xs(i)) + beaver_trilog(xs(i)) + beaver_svdilog(xs(i)) + beaver_clausen2(xs(i)) &
+                + beaver_log1m(xs(i)) + beaver_dilog_1m(xs(i)) + beaver_trilog_1m(xs(i)) + beaver_svdilog_1m(xs(i)) &
+                + beaver_pow(xs(i), 5_c_int) + real(beaver_li2_unit_circle(xs(i)), c_double), i = 1, 3)])
+  call same_c('pure array forms', complex_array_forms(zs), &
+              [(beaver_dilog(zs(i)) + beaver_trilog(zs(i)) + beaver_svdilog(zs(i)), i = 1, 2)])
+
+  if (failures /= 0) then
+    print '(a,i0,a)', 'fortran: ', failures, ' check(s) failed'
+    error stop 1
+  end if
+  print '(a)', 'fortran: all checks passed'
+
+contains
+
+  ! the array forms are pure, so they can be called from pure code
+  pure function array_forms(v) result(r)
+    real(c_double), intent(in) :: v(:)
+    real(c_double) :: r(size(v))
+    r = beaver_log(v) + beaver_log1p(v) + beaver_arctan(v) + beaver_atanint(v) &
+        + beaver_dilog(v) + beaver_trilog(v) + beaver_svdilog(v) + beaver_clausen2(v) &
+        + beaver_log1m(v) + beaver_dilog_1m(v) + beaver_trilog_1m(v) + beaver_svdilog_1m(v) &
+        + beaver_pow(v, 5_c_int) + real(beaver_li2_unit_circle(v), c_double)
+  end function array_forms
+
+  pure function complex_array_forms(w) result(r)
+    complex(c_double_complex), intent(in) :: w(:)
+    complex(c_double_complex) :: r(size(w))
+    r = beaver_dilog(w) + beaver_trilog(w) + beaver_svdilog(w)
+  end function complex_array_forms
+
+  subroutine close_r(what, got, ref)
+    character(*), intent(in) :: what
+    real(c_double), intent(in) :: got, ref
+    if (.not. (abs(got - ref) <= 4e-15_c_double * abs(ref))) then
+      failures = failures + 1
+      print '(a,a,2es26.17)', 'FAIL ', what, got, ref
+    end if
+  end subroutine close_r
+
+  subroutine close_c(what, got, ref)
+    character(*), intent(in) :: what
+    complex(c_double_complex), intent(in) :: got, ref
+    call close_r(what, real(got, c_double), real(ref, c_double))
+    call close_r(what, aimag(got), aimag(ref))
+  end subroutine close_c
+
+  subroutine same_r(what, got, ref)
+    character(*), intent(in) :: what
+    real(c_double), intent(in) :: got(:), ref(:)
+    if (any(got /= ref)) then
+      failures = failures + 1
+      print '(a,a,a)', 'FAIL ', what, ': array form differs from the scalar form'
+    end if
+  end subroutine same_r
+
+  subroutine same_c(what, got, ref)
+    character(*), intent(in) :: what
+    complex(c_double_complex), intent(in) :: got(:), ref(:)
+    if (any(got /= ref)) then
+      failures = failures + 1
+      print '(a,a,a)', 'FAIL ', what, ': array form differs from the scalar form'
+    end if
+  end subroutine same_c
+
+end program test_fortran
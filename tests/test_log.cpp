@@ -0,0 +1,127 @@
+// log and log1p against reference values (mpmath, 60 digits): the MiniMax paths, both sides of the
+// switches at |x-1|=0.25, |x|=1e-3 and |x|=0.3, subnormal arguments, and log1p arguments whose 1+x rounds
+// (the table path must keep the low bits of x). The array forms must match the scalar calls.
+#include "beaver.hpp"
+#include "check.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+  struct point { double x, ref; };
+  const point log1p_points[]={
+    {5e-324, 4.9406564584124654418e-324},
+    {-5e-324, -4.9406564584124654418e-324},
+    {2.5e-310, 2.5000000000000170656e-310},
+    {1e-300, 1.0000000000000000251e-300},
+    {1e-05, 9.9999500003333316514e-6},
+    {-1e-05, -0.000010000050000333336651},
+    {0.001, 0.00099950033308353318761},
+    {-0.001, -0.001000500333583533521},
+    {0.0010000000000000002, 0.00099950033308353340423},
+    {-0.0010000000000000002, -0.001000500333583533738},
+    {0.1, 0.09531017980432486509},
+    {-0.2, -0.22314355131420976964},
+    {0.3, 0.2623642644674910435},
+    {-0.3, -0.35667494393873236305},
+    {0.30000000000000004, 0.2623642644674910862},
+    {-0.30000000000000004, -0.35667494393873244235},
+    {0.5, 0.40546510810816438198},
+    {-0.5, -0.69314718055994530942},
+    {0.7, 0.53062825106217037011},
+    {-0.75, -1.3862943611198906188},
+    {-0.9, -2.3025850929940459061},
+    {1.0, 0.69314718055994530942},
+    {1.2345678901234567, 0.80404787162101123367},
+    {-0.999999, -13.81551055793551844},
+    {-0.9999999999999999, -36.736800569677101399},
+    {2.0, 1.0986122886681096914},
+    {3.0000000000000004, 1.3862943611198907299},
+    {100.0, 4.6151205168412594509},
+    {123456789.123, 18.631401775264318042},
+    {4503599627370495.5, 36.043653389117156201},
+    {10000000000.0, 23.02585093004045684},
+    {1e+300, 690.77552789821370526},
+    {1.7976931348623157e+308, 709.78271289338399673},
+  };
+  //Taylor path |x|<1e-3, correctly rounded up to a last addition of x and the correction
+  const point log1p_taylor_points[]={
+    {0.0009999999999999998, 0.00099950033308353297098},
+    {-0.0009999999999999998, -0.0010005003335835333039},
+    {0.00075, 0.00074971889054594588439},
+    {-0.00061, -0.00061018612569496481},
+    {3.3e-07, 3.2999994555001199583e-7},
+    {-2.7e-09, -2.7000000036450001954e-9},
+  };
+  const point log_points[]={
+    {5e-324, -744.44007192138126231},
+    {1e-320, -736.82724089097390615},
+    {2.2250738585072014e-308, -708.39641853226410622},
+    {1e-300, -690.77552789821370518},
+    {1e-10, -23.025850929940456804},
+    {0.5, -0.69314718055994530942},
+    {0.7499999999999999, -0.28768207245178107547},
+    {0.75, -0.28768207245178092744},
+    {0.9, -0.10536051565782627656},
+    {0.999, -0.0010005003335835343892},
+    {0.9999999999999999, -1.1102230246251566021e-16},
+    {1.0000000000000002, 2.2204460492503128343e-16},
+    {1.1, 0.095310179804324940787},
+    {1.25, 0.22314355131420975577},
+    {1.2500000000000002, 0.2231435513142099334},
+    {1.5, 0.40546510810816438198},
+    {2.0, 0.69314718055994530942},
+    {3.0, 1.0986122886681096914},
+    {10.0, 2.302585092994045684},
+    {10000000000.0, 23.02585092994045684},
+    {1e+300, 690.77552789821370526},
+    {1.7976931348623157e+308, 709.78271289338399673},
+  };
+  //relative accuracy of the MiniMax and table kernels, and of the log1p Taylor path (about half an ulp)
+  const double tol=4e-16;
+  const double taylor_tol=1.2e-16;
+
+  template<class F>
+  void check_array(const char* name, void (*array)(const double*, double*, std::size_t), F scalar, const std::vector<double>& x) {
+    std::vector<double> out(x.size());
+    array(x.data(),out.data(),x.size());
+    for(std::size_t i=0;i<x.size();++i){
+      beaver_test::check_same(name,x[i],out[i],scalar(x[i]));
+    }
+  }
+}
+
+int main() {
+  using beaver_test::check_close;
+  using beaver_test::check_same;
+  for(const point& p : log1p_points){
+    check_close("log1p",p.x,beaver::log1p(p.x),p.ref,tol);
+    check_close("unchecked::log1p",p.x,beaver::unchecked::log1p(p.x),p.ref,tol);
+  }
+  for(const point& p : log1p_taylor_points){
+    check_close("log1p",p.x,beaver::log1p(p.x),p.ref,taylor_tol);
+    check_close("unchecked::log1p",p.x,beaver::unchecked::log1p(p.x),p.ref,taylor_tol);
+  }
+  for(const point& p : log_points){
+    check_close("log",p.x,beaver::log(p.x),p.ref,tol);
+    check_close("unchecked::log",p.x,beaver::unchecked::log(p.x),p.ref,tol);
+  }
+  const double nan=std::numeric_limits<double>::quiet_NaN();
+  const double inf=std::numeric_limits<double>::infinity();
+  check_same("log1p",0.0,beaver::log1p(0.0),0.0);
+  check_same("log1p",-1.0,beaver::log1p(-1.0),-inf);
+  check_same("log1p",-2.0,beaver::log1p(-2.0),nan);
+  check_same("log1p",nan,beaver::log1p(nan),nan);
+  check_same("log",1.0,beaver::log(1.0),0.0);
+  check_same("log",0.0,beaver::log(0.0),-inf);
+  check_same("log",-1.0,beaver::log(-1.0),nan);
+
+  //array forms, including the special values
+  std::vector<double> x1p{0.0,-1.0,-2.0,nan};
+  for(const point& p : log1p_points) x1p.push_back(p.x);
+  check_array("log1p array",beaver::log1p,[](double x){ return beaver::log1p(x); },x1p);
+  std::vector<double> xl{0.0,1.0,-1.0};
+  for(const point& p : log_points) xl.push_back(p.x);
+  check_array("log array",beaver::log,[](double x){ return beaver::log(x); },xl);
+  return beaver_test::report("log");
+}
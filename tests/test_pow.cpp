@@ -0,0 +1,92 @@
+// powers<N> against pow<k>, and the array and span forms of the runtime-exponent pow against std::pow
+// for every n in [-POW_STDPOW_CUTOFF, POW_STDPOW_CUTOFF] (unrolled loops) and just outside (std::pow).
+// The unrolled product tree rounds once per multiply and squaring doubles the relative error
+// already present, so x^n is within about |n| eps of std::pow.
+#include "beaver.hpp"
+#include "check.hpp"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+  //powers<N>(x) is usable in constant expressions
+  static_assert(beaver::powers<0>(2.0)[0]==1.0, "powers<0>");
+  static_assert(beaver::powers<1>(3.0)[1]==3.0, "powers<1>");
+  static_assert(beaver::powers<10>(2.0)[10]==1024.0 && beaver::powers<10>(2.0)[7]==128.0, "powers<10>");
+
+  //every entry of the ladder {1,x,...,x^N} against pow<k>: both are exact for x=+-2^m, otherwise the
+  //two product trees may round differently, each within about k eps
+  template<int N, std::size_t... K>
+  void check_powers(double x, std::index_sequence<K...>) {
+    const std::array<double,N+1> p=beaver::powers<N>(x);
+    const double eps=std::numeric_limits<double>::epsilon();
+    (beaver_test::check_close("powers",x,p[K],beaver::pow<static_cast<int>(K)>(x),(2*K+1)*eps),...);
+  }
+  template<int N>
+  void check_powers(double x) {
+    check_powers<N>(x,std::make_index_sequence<N+1>{});
+    const std::array<double,N+1> p=beaver::powers<N>(x);
+    beaver_test::check("powers size",p.size()==N+1 && p[0]==1.0);
+  }
+}
+
+int main() {
+  const int cutoff=beaver::POW_STDPOW_CUTOFF;
+  const double eps=std::numeric_limits<double>::epsilon();
+  const double inf=std::numeric_limits<double>::infinity();
+  const double nan=std::numeric_limits<double>::quiet_NaN();
+  std::mt19937_64 gen(7);
+  std::uniform_real_distribution<double> base(0.5,2.0);
+  std::vector<double> x;
+  for(int i=0;i<500;++i){
+    const double v=base(gen);
+    x.push_back((i%2==0) ? v : -v);
+  }
+  //special values, compared bit for bit with the scalar pow
+  const double special[]={0.0,-0.0,1.0,-1.0,inf,-inf,nan};
+  x.insert(x.end(),std::begin(special),std::end(special));
+  const std::size_t nfinite=x.size()-std::size(special);
+
+  std::vector<double> out(x.size());
+  for(int n=-cutoff-2;n<=cutoff+2;++n){
+    const bool unrolled=(n>=-cutoff && n<=cutoff);
+    beaver::pow(x.data(),out.data(),x.size(),n);
+    for(std::size_t i=0;i<x.size();++i){
+      beaver_test::check_same("pow array vs scalar",x[i],out[i],beaver::pow(x[i],n));
+      const double ref=std::pow(x[i],static_cast<double>(n));
+      if(!unrolled){
+        beaver_test::check_same("pow array vs std::pow",x[i],out[i],ref);
+      }else if(i<nfinite){
+        beaver_test::check_close("pow array vs std::pow",x[i],out[i],ref,(std::abs(n)+1)*eps);
+      }
+    }
+#ifdef BEAVER_HAS_SPAN
+    std::vector<double> span_out(x.size());
+    beaver::pow(std::span<const double>(x),n,std::span<double>(span_out));
+    for(std::size_t i=0;i<x.size();++i){
+      beaver_test::check_same("pow span vs array",x[i],span_out[i],out[i]);
+    }
+#endif
+  }
+  //n=0 is 1 for every base, NaN included
+  beaver::pow(x.data(),out.data(),x.size(),0);
+  for(std::size_t i=0;i<x.size();++i) beaver_test::check_same("pow(x,0)",x[i],out[i],1.0);
+
+  for(double v : {0.75,-1.3,2.0,-0.5,1.0000001}){
+    check_powers<0>(v);
+    check_powers<1>(v);
+    check_powers<2>(v);
+    check_powers<7>(v);
+    check_powers<8>(v);
+    check_powers<13>(v);
+    check_powers<32>(v);
+    check_powers<63>(v);
+  }
+  //powers of two are exact in both trees
+  const std::array<double,41> p2=beaver::powers<40>(-2.0);
+  for(int k=0;k<=40;++k) beaver_test::check_same("powers(-2)",-2.0,p2[static_cast<std::size_t>(k)],std::ldexp((k%2==0) ? 1.0 : -1.0,k));
+  return beaver_test::report("pow");
+}
@@ -0,0 +1,103 @@
+"""Smoke test of the NumPy ufunc module: values, dtypes, broadcasting, strides, out=/where=,
+int64 exponents of pow and the threaded loops. Usage: test_python.py <directory of the module>"""
+import math
+import sys
+import threading
+
+sys.path.insert(0, sys.argv[1])
+import numpy as np  # noqa: E402
+import beaver  # noqa: E402
+
+failures = 0
+
+
+def check(what, ok):
+    global failures
+    if not ok:
+        failures += 1
+        print("FAIL", what)
+
+
+def close(a, b, tol=4e-15):
+    return np.allclose(a, b, rtol=tol, atol=0.0)
+
+
+zeta2 = math.pi ** 2 / 6
+zeta3 = 1.2020569031595942854
+ln2 = math.log(2.0)
+
+# values against closed forms
+check("log", close(beaver.log(np.array([0.5, 2.0, 10.0])), np.log([0.5, 2.0, 10.0])))
+check("log1p", close(beaver.log1p(np.array([1e-10, 0.5])), np.log1p([1e-10, 0.5])))
+check("arctan", close(beaver.arctan(np.array([0.3, -4.0])), np.arctan([0.3, -4.0])))
+check("atanint", close(beaver.atanint(1.0), 0.91596559417721901505))
+check("dilog", close(beaver.dilog(np.array([0.5, 1.0, -1.0])), [zeta2 / 2 - ln2 ** 2 / 2, zeta2, -zeta2 / 2]))
+check("trilog", close(beaver.trilog(np.array([1.0, -1.0])), [zeta3, -0.75 * zeta3]))
+check("svdilog", close(beaver.svdilog(np.array([1.0, 0.5])), [zeta2, zeta2 / 2]))
+check("dilog x>1", np.isnan(beaver.dilog(2.0)))
+z = np.array([2.0 + 0.0j, -2.9 + 0.5j])
+check("complex dilog", close(beaver.dilog(z)[1], -1.9019393570513473584 + 0.23407253725944682501j))
+check("complex dilog on the cut", close(beaver.dilog(z)[0], math.pi ** 2 / 4 + 1j * math.pi * ln2))
+
+# dtypes: float32 stays float32, complex inputs take the complex loops
+for dt in (np.float32, np.float64):
+    x = np.linspace(0.1, 0.9, 7, dtype=dt)
+    check("dtype " + np.dtype(dt).name, beaver.dilog(x).dtype == dt)
+    check("values " + np.dtype(dt).name, close(beaver.dilog(x), beaver.dilog(x.astype(np.float64)), 1e-6))
+for dt in (np.complex64, np.complex128):
+    check("dtype " + np.dtype(dt).name, beaver.svdilog(z.astype(dt)).dtype == dt)
+check("svdilog conj", beaver.svdilog(np.conj(z[1])) == np.conj(beaver.svdilog(z[1])))
+
+# broadcasting, strides, out= and where=
+x = np.linspace(-3.0, 3.0, 13)
+n = np.arange(-4, 5, dtype=np.int64)
+check("pow broadcast", close(beaver.pow(x[:, None], n[None, :]), x[:, None] ** n[None, :].astype(float)))
+check("pow int32", close(beaver.pow(x, np.int32(3)), x ** 3))
+check("strided", np.array_equal(beaver.log(x[7::2]), beaver.log(x[7::2].copy())))
+out = np.full_like(x, -7.0)
+beaver.dilog(x, out=out, where=x < 0)
+check("where", np.array_equal(out[x < 0], beaver.dilog(x[x < 0])) and np.all(out[x >= 0] == -7.0))
+
+# int64 exponents beyond the int range keep their value and parity
+big = 2 ** 40
+check("pow(-1, 2^40)", beaver.pow(-1.0, big) == 1.0)
+check("pow(-1, 2^40+1)", beaver.pow(-1.0, big + 1) == -1.0)
+check("pow(-1, 2^62+1)", beaver.pow(-1.0, 2 ** 62 + 1) == -1.0)
+check("pow(1.0000001, 2^40)", math.isinf(beaver.pow(1.0000001, big)))
+check("pow(2, -2^40)", beaver.pow(2.0, -big) == 0.0)
+check("pow(-0, -2^40-1)", beaver.pow(-0.0, -big - 1) == -math.inf)
+xs = np.full(1000, -1.0)
+check("pow broadcast 2^40+1", np.all(beaver.pow(xs, np.int64(big + 1)) == -1.0))
+
+# threaded loops: same bits for any number of threads, also with concurrent callers
+xl = np.linspace(-5.0, 0.999, 300001)
+beaver.set_num_threads(1)
+ref = beaver.dilog(xl)
+ref_pow = beaver.pow(xl, np.int64(7))
+beaver.set_num_threads(4)
+check("get_num_threads", beaver.get_num_threads() == 4)
+check("threads dilog", np.array_equal(beaver.dilog(xl), ref))
+check("threads pow", np.array_equal(beaver.pow(xl, np.int64(7)), ref_pow))
+results = [None] * 4
+
+
+def work(k):
+    results[k] = beaver.dilog(xl)
+
+
+callers = [threading.Thread(target=work, args=(k,)) for k in range(4)]
+for c in callers:
+    c.start()
+for c in callers:
+    c.join()
+check("concurrent callers", all(np.array_equal(r, ref) for r in results))
+try:
+    beaver.set_num_threads(0)
+    check("set_num_threads(0) raises", False)
+except ValueError:
+    pass
+
+if failures:
+    print("python: %d check(s) failed" % failures)
+    sys.exit(1)
+print("python: all checks passed")
@@ -0,0 +1,98 @@
+// Region-tagged and unchecked entry points against the checked functions. They share the kernels of
+// each region, so every result has to agree bit for bit, end points of the regions included.
+#include "beaver.hpp"
+#include "check.hpp"
+#include <cmath>
+#include <vector>
+
+namespace {
+  namespace region=beaver::region;
+
+  //sample points of [lo,hi]: both end points, their neighbours inside and a uniform grid in between
+  std::vector<double> sample(double lo, double hi, bool with_lo, bool with_hi) {
+    std::vector<double> x;
+    if(with_lo) x.push_back(lo);
+    if(with_hi) x.push_back(hi);
+    x.push_back(std::nextafter(lo,hi));
+    x.push_back(std::nextafter(hi,lo));
+    const int n=997;
+    for(int i=1;i<n;++i) x.push_back(lo+(hi-lo)*i/n);
+    return x;
+  }
+
+  //the switch points of the kernels, where the tags and the checked functions must not part ways
+  const double switches[]={-1e4,-1e-4,1e-4,0.5,1-1e-4};
+
+  template<class Tag>
+  void compare(const char* name, const std::vector<double>& x, Tag tag) {
+    std::vector<double> out(x.size());
+    for(double v : x){
+      beaver_test::check_same(name,v,beaver::dilog(v,tag),beaver::dilog(v));
+      beaver_test::check_same(name,v,beaver::trilog(v,tag),beaver::trilog(v));
+      beaver_test::check_same(name,v,beaver::svdilog(v,tag),beaver::svdilog(v));
+    }
+    beaver::dilog(x.data(),out.data(),x.size(),tag);
+    for(std::size_t i=0;i<x.size();++i) beaver_test::check_same("dilog array",x[i],out[i],beaver::dilog(x[i]));
+    beaver::trilog(x.data(),out.data(),x.size(),tag);
+    for(std::size_t i=0;i<x.size();++i) beaver_test::check_same("trilog array",x[i],out[i],beaver::trilog(x[i]));
+    beaver::svdilog(x.data(),out.data(),x.size(),tag);
+    for(std::size_t i=0;i<x.size();++i) beaver_test::check_same("svdilog array",x[i],out[i],beaver::svdilog(x[i]));
+  }
+}
+
+int main() {
+  std::vector<double> below=sample(-1e6,-1.0,true,false);
+  std::vector<double> negative=sample(-1.0,0.0,true,true);
+  std::vector<double> lower=sample(0.0,0.5,true,true);
+  std::vector<double> upper=sample(0.5,1.0,false,false);
+  std::vector<double> unit=sample(0.0,1.0,false,false);
+  for(double s : switches){
+    for(double v : {std::nextafter(s,-1e300),s,std::nextafter(s,1e300)}){
+      if(v<-1) below.push_back(v);
+      else if(v<=0) negative.push_back(v);
+      else if(v<=0.5) lower.push_back(v);
+      else upper.push_back(v);
+      if(v>0 && v<1) unit.push_back(v);
+    }
+  }
+  negative.push_back(-0.0);
+  lower.push_back(1e-300);
+  compare("below_minus_one",below,region::below_minus_one);
+  compare("negative_unit",negative,region::negative_unit);
+  compare("lower_half",lower,region::lower_half);
+  compare("upper_half",upper,region::upper_half);
+  compare("unit_interval",unit,region::unit_interval);
+
+  //unchecked: any finite x<1 for dilog and trilog, x!=0,1 for svdilog
+  std::vector<double> x;
+  for(const std::vector<double>* part : {&below,&negative,&lower,&upper}) x.insert(x.end(),part->begin(),part->end());
+  for(double v : x){
+    beaver_test::check_same("unchecked::dilog",v,beaver::unchecked::dilog(v),beaver::dilog(v));
+    beaver_test::check_same("unchecked::trilog",v,beaver::unchecked::trilog(v),beaver::trilog(v));
+    if(v!=0) beaver_test::check_same("unchecked::svdilog",v,beaver::unchecked::svdilog(v),beaver::svdilog(v));
+  }
+  for(double v : {1.5,2.0,40.0,1e6}){
+    beaver_test::check_same("unchecked::svdilog",v,beaver::unchecked::svdilog(v),beaver::svdilog(v));
+  }
+  std::vector<double> out(x.size());
+  beaver::unchecked::dilog(x.data(),out.data(),x.size());
+  for(std::size_t i=0;i<x.size();++i) beaver_test::check_same("unchecked::dilog array",x[i],out[i],beaver::dilog(x[i]));
+  beaver::unchecked::trilog(x.data(),out.data(),x.size());
+  for(std::size_t i=0;i<x.size();++i) beaver_test::check_same("unchecked::trilog array",x[i],out[i],beaver::trilog(x[i]));
+
+  //unchecked arctan and atanint: each kernel region of either sign, its switch points and x=+-0, +-1,
+  //which the checked functions also leave to the kernel
+  std::vector<double> t={0.0,1.0,1e-300,1e-8,0.25,0.75,2.0,100.0,1e6,1e300};
+  for(double s : {1e-4,1e-3,1.0,1e3,1e4}){
+    t.push_back(std::nextafter(s,0.0));
+    t.push_back(s);
+    t.push_back(std::nextafter(s,1e300));
+  }
+  const std::size_t half=t.size();
+  for(std::size_t i=0;i<half;++i) t.push_back(-t[i]);
+  for(double v : t){
+    beaver_test::check_same("unchecked::arctan",v,beaver::unchecked::arctan(v),beaver::arctan(v));
+    beaver_test::check_same("unchecked::atanint",v,beaver::unchecked::atanint(v),beaver::atanint(v));
+  }
+  return beaver_test::report("region");
+}
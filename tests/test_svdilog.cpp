@@ -0,0 +1,214 @@
+// Complex single-valued dilogarithm against reference values (mpmath, 240 digits). The imaginary part
+// is the Bloch-Wigner function D(z), which vanishes like Im z on the real axis: near the axis Re and
+// Im are each checked with relative error, so that D keeps all its digits as Im z->0.
+#include "beaver.hpp"
+#include "check.hpp"
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace {
+  struct point { double x, y, re, im; };
+  //{x, y, Re Li2(z)+1/2 log|z| log|1-z|, D(z)}
+  const point points[]={
+    {-50.0, 0.001, -1.5862990208788950888, 1.9301792140388105785e-6},
+    {-50.0, -0.001, -1.5862990208788950888, -1.9301792140388105785e-6},
+    {-50.0, 1.5e-09, -1.5862990210578023953, 2.8952688220784184648e-12},
+    {-50.0, -1.5e-09, -1.5862990210578023953, -2.8952688220784184648e-12},
+    {-50.0, 1.3e-11, -1.5862990210578023953, 2.5092329791346294193e-14},
+    {-50.0, -1.3e-11, -1.5862990210578023953, -2.5092329791346294193e-14},
+    {-50.0, 1e-14, -1.5862990210578023953, 1.9301792147189456538e-17},
+    {-50.0, -1e-14, -1.5862990210578023953, -1.9301792147189456538e-17},
+    {-50.0, 1e-200, -1.5862990210578023953, 1.9301792147189456215e-203},
+    {-50.0, -1e-200, -1.5862990210578023953, -1.9301792147189456215e-203},
+    {-2.9, 0.001, -1.1682844655743982251, 0.000196299492706018213},
+    {-2.9, -0.001, -1.1682844655743982251, -0.000196299492706018213},
+    {-2.9, 1.5e-09, -1.1682844868261469661, 2.9444925994042450681e-10},
+    {-2.9, -1.5e-09, -1.1682844868261469661, -2.9444925994042450681e-10},
+    {-2.9, 1.3e-11, -1.1682844868261469662, 2.5518935861503458106e-12},
+    {-2.9, -1.3e-11, -1.1682844868261469662, -2.5518935861503458106e-12},
+    {-2.9, 1e-14, -1.1682844868261469662, 1.9629950662694967231e-15},
+    {-2.9, -1e-14, -1.1682844868261469662, -1.9629950662694967231e-15},
+    {-2.9, 1e-200, -1.1682844868261469662, 1.9629950662694966903e-201},
+    {-2.9, -1e-200, -1.1682844868261469662, -1.9629950662694966903e-201},
+    {-1.0, 0.001, -0.82246695671095713145, 0.00069314690784436647487},
+    {-1.0, -0.001, -0.82246695671095713145, -0.00069314690784436647487},
+    {-1.0, 1.5e-09, -0.82246703342411321806, 1.0397207708399179563e-9},
+    {-1.0, -1.5e-09, -0.82246703342411321806, -1.0397207708399179563e-9},
+    {-1.0, 1.3e-11, -0.82246703342411321824, 9.0109133472792892611e-12},
+    {-1.0, -1.3e-11, -0.82246703342411321824, -9.0109133472792892611e-12},
+    {-1.0, 1e-14, -0.82246703342411321824, 6.931471805599453086e-15},
+    {-1.0, -1e-14, -0.82246703342411321824, -6.931471805599453086e-15},
+    {-1.0, 1e-200, -0.82246703342411321824, 6.9314718055994529701e-201},
+    {-1.0, -1e-200, -0.82246703342411321824, -6.9314718055994529701e-201},
+    {-0.7, 0.001, -0.69978918460269646175, 0.00096784849164588108511},
+    {-0.7, -0.001, -0.69978918460269646175, -0.00096784849164588108511},
+    {-0.7, 1.5e-09, -0.6997893031876588802, 1.4517737238186584788e-9},
+    {-0.7, -1.5e-09, -0.6997893031876588802, -1.4517737238186584788e-9},
+    {-0.7, 1.3e-11, -0.69978930318765888047, 1.2582038939761707252e-11},
+    {-0.7, -1.3e-11, -0.69978930318765888047, -1.2582038939761707252e-11},
+    {-0.7, 1e-14, -0.69978930318765888047, 9.6784914921243899262e-15},
+    {-0.7, -1e-14, -0.69978930318765888047, -9.6784914921243899262e-15},
+    {-0.7, 1e-200, -0.69978930318765888047, 9.6784914921243897644e-201},
+    {-0.7, -1e-200, -0.69978930318765888047, -9.6784914921243897644e-201},
+    {0.3, 0.001, 0.54084097186750500209, 0.0029088682761584636864},
+    {0.3, -0.001, 0.54084097186750500209, -0.0029088682761584636864},
+    {0.3, 1.5e-09, 0.54084297631883186304, 4.3633164432492389861e-9},
+    {0.3, -1.5e-09, 0.54084297631883186304, -4.3633164432492389861e-9},
+    {0.3, 1.3e-11, 0.54084297631883186755, 3.7815409174826739406e-11},
+    {0.3, -1.3e-11, 0.54084297631883186755, -3.7815409174826739406e-11},
+    {0.3, 1e-14, 0.54084297631883186755, 2.9088776288328260277e-14},
+    {0.3, -1e-14, 0.54084297631883186755, -2.9088776288328260277e-14},
+    {0.3, 1e-200, 0.54084297631883186755, 2.9088776288328259791e-200},
+    {0.3, -1e-200, 0.54084297631883186755, -2.9088776288328259791e-200},
+    {0.5, 0.001, 0.82246503342944653521, 0.0027725823588066238674},
+    {0.5, -0.001, 0.82246503342944653521, -0.0027725823588066238674},
+    {0.5, 1.5e-09, 0.82246703342411321374, 4.1588830833596718074e-9},
+    {0.5, -1.5e-09, 0.82246703342411321374, -4.1588830833596718074e-9},
+    {0.5, 1.3e-11, 0.82246703342411321824, 3.6043653389117157044e-11},
+    {0.5, -1.3e-11, 0.82246703342411321824, -3.6043653389117157044e-11},
+    {0.5, 1e-14, 0.82246703342411321824, 2.7725887222397812344e-14},
+    {0.5, -1e-14, 0.82246703342411321824, -2.7725887222397812344e-14},
+    {0.5, 1e-200, 0.82246703342411321824, 2.772588722239781188e-200},
+    {0.5, -1e-200, 0.82246703342411321824, -2.772588722239781188e-200},
+    {0.8, 0.001, 1.2543585547802776245, 0.0031274982914424260395},
+    {0.8, -0.001, 1.2543585547802776245, -0.0031274982914424260395},
+    {0.8, 1.5e-09, 1.2543624457083850723, 4.6912727206705114866e-9},
+    {0.8, -1.5e-09, 1.2543624457083850723, -4.6912727206705114866e-9},
+    {0.8, 1.3e-11, 1.2543624457083850811, 4.0657696912477768058e-11},
+    {0.8, -1.3e-11, 1.2543624457083850811, -4.0657696912477768058e-11},
+    {0.8, 1e-14, 1.2543624457083850811, 3.1275151471136743795e-14},
+    {0.8, -1e-14, 1.2543624457083850811, -3.1275151471136743795e-14},
+    {0.8, 1e-200, 1.2543624457083850811, 3.1275151471136743272e-200},
+    {0.8, -1e-200, 1.2543624457083850811, -3.1275151471136743272e-200},
+    {0.999, 0.001, 1.6398672943315325196, 0.0075682474667287963708},
+    {0.999, -0.001, 1.6398672943315325196, -0.0075682474667287963708},
+    {0.999, 1.5e-09, 1.6404782110065835755, 1.187275542377021183e-8},
+    {0.999, -1.5e-09, 1.6404782110065835755, -1.187275542377021183e-8},
+    {0.999, 1.3e-11, 1.6404782110065852604, 1.0289721367268981122e-10},
+    {0.999, -1.3e-11, 1.6404782110065852604, -1.0289721367268981122e-10},
+    {0.999, 1e-14, 1.6404782110065852605, 7.9151702825146007285e-14},
+    {0.999, -1e-14, 1.6404782110065852605, -7.9151702825146007285e-14},
+    {0.999, 1e-200, 1.6404782110065852605, 7.9151702825146005962e-200},
+    {0.999, -1e-200, 1.6404782110065852605, -7.9151702825146005962e-200},
+    {1.001, 0.001, 1.6468608154203255536, 0.0075541251033514662091},
+    {1.001, -0.001, 1.6468608154203255536, -0.0075541251033514662091},
+    {1.001, 1.5e-09, 1.6493859641026961337, 1.1850532136460149316e-8},
+    {1.001, -1.5e-09, 1.6493859641026961337, -1.1850532136460149316e-8},
+    {1.001, 1.3e-11, 1.6493859687695758383, 1.0270461184933590683e-10},
+    {1.001, -1.3e-11, 1.6493859687695758383, -1.0270461184933590683e-10},
+    {1.001, 1e-14, 1.6493859688103443582, 7.9003547576412234684e-14},
+    {1.001, -1e-14, 1.6493859688103443582, -7.9003547576412234684e-14},
+    {1.001, 1e-200, 1.6493859688103757428, 7.9003547576412233363e-200},
+    {1.001, -1e-200, 1.6493859688103757428, -7.9003547576412233363e-200},
+    {1.5, 0.001, 2.2317785263767714332, 0.0012730268905969500507},
+    {1.5, -0.001, 2.2317785263767714332, -0.0012730268905969500507},
+    {1.5, 1.5e-09, 2.2338717688805837688, 1.9095425048844384378e-9},
+    {1.5, -1.5e-09, 2.2338717688805837688, -1.9095425048844384378e-9},
+    {1.5, 1.3e-11, 2.2338717719949492835, 1.6549368375665133718e-11},
+    {1.5, -1.3e-11, 2.2338717719949492835, -1.6549368375665133718e-11},
+    {1.5, 1e-14, 2.2338717720221554758, 1.2730283365896256354e-14},
+    {1.5, -1e-14, 2.2338717720221554758, -1.2730283365896256354e-14},
+    {1.5, 1e-200, 2.2338717720221764198, 1.2730283365896256141e-200},
+    {1.5, -1e-200, 2.2338717720221764198, -1.2730283365896256141e-200},
+    {1.9, 0.001, 2.429257302409458499, 0.00076862353201013010269},
+    {1.9, -0.001, 2.429257302409458499, -0.00076862353201013010269},
+    {1.9, 1.5e-09, 2.4309102717973349274, 1.1529358314206963686e-9},
+    {1.9, -1.5e-09, 2.4309102717973349274, -1.1529358314206963686e-9},
+    {1.9, 1.3e-11, 2.4309102742560445452, 9.9921105389793688691e-12},
+    {1.9, -1.3e-11, 2.4309102742560445452, -9.9921105389793688691e-12},
+    {1.9, 1e-14, 2.4309102742775231181, 7.6862388761379758405e-15},
+    {1.9, -1e-14, 2.4309102742775231181, -7.6862388761379758405e-15},
+    {1.9, 1e-200, 2.4309102742775396528, 7.686238876137975712e-201},
+    {1.9, -1e-200, 2.4309102742775396528, -7.686238876137975712e-201},
+    {7.0, 0.001, 2.991125867346778077, 0.000068352718358567715738},
+    {7.0, -0.001, 2.991125867346778077, -0.000068352718358567715738},
+    {7.0, 1.5e-09, 2.9915746493446428121, 1.0252907957210225399e-10},
+    {7.0, -1.5e-09, 2.9915746493446428121, -1.0252907957210225399e-10},
+    {7.0, 1.3e-11, 2.9915746500120068515, 8.8858535629155289738e-13},
+    {7.0, -1.3e-11, 2.9915746500120068515, -8.8858535629155289738e-13},
+    {7.0, 1e-14, 2.9915746500178367499, 6.8352719714734836368e-16},
+    {7.0, -1e-14, 2.9915746500178367499, -6.8352719714734836368e-16},
+    {7.0, 1e-200, 2.9915746500178412379, 6.8352719714734835226e-202},
+    {7.0, -1e-200, 2.9915746500178412379, -6.8352719714734835226e-202},
+    {40.0, 0.001, 3.2179344124636038646, 2.9976115146304648452e-6},
+    {40.0, -0.001, 3.2179344124636038646, -2.9976115146304648452e-6},
+    {40.0, 1.5e-09, 3.2180129518077115127, 4.4964172745204244351e-12},
+    {40.0, -1.5e-09, 3.2180129518077115127, -4.4964172745204244351e-12},
+    {40.0, 1.3e-11, 3.2180129519245002196, 3.8968949712510346396e-14},
+    {40.0, -1.3e-11, 3.2180129519245002196, -3.8968949712510346396e-14},
+    {40.0, 1e-14, 3.2180129519255204518, 2.9976115163469496398e-17},
+    {40.0, -1e-14, 3.2180129519255204518, -2.9976115163469496398e-17},
+    {40.0, 1e-200, 3.2180129519255212372, 2.9976115163469495897e-203},
+    {40.0, -1e-200, 3.2180129519255212372, -2.9976115163469495897e-203},
+    {0.5, 0.5, 0.5140418958900707614, 0.91596559417721901505},
+    {-0.3, 0.9, -0.41969529341991014578, 0.7806525216948218233},
+    {0.9, 0.4, 1.0250213333485029582, 0.78354992363441331746},
+    {1.2, -0.3, 1.4326669684232596868, -0.52144485921497390345},
+    {-3.0, 2.0, -1.1108194689591270963, 0.29765684950310575357},
+    {2.5, 7.0, 0.10721034355088502323, 0.39404771809009222417},
+    {0.0, 1.0, -0.20561675835602830456, 0.91596559417721901505},
+    {0.6, -0.8, 0.40331124988898538666, -1.0084130373169353797},
+    {0.5, 0.8660254037844386, 0.27415567780803776568, 1.014941606409653625},
+    {1e-08, 1e-08, 1.0037053576836195984e-7, 1.9074107339413465959e-7},
+    {1e-05, -3e-09, 0.000067564939924988449, -3.7539136651227202756e-8},
+    {1.0, 1e-06, 1.6449324960556035197, 0.000014815510557959557198},
+    {-1000000.0, 3.0, -1.6449261590921513985, 4.4446488727017076883e-11},
+    {0.2, 1e-07, 0.39057162113981785181, 3.1275151471135055128e-7},
+    {0.25, 0.0001, 0.46705863517963577611, 0.00029991206515673008496},
+    {7.061924386819276e-13, 1.32e-12, 1.0320132453824773683e-11, 3.7260347488554983646e-11},
+    {-3e-10, 1e-10, -3.5811837570590239087e-9, 2.2874558376731067321e-9},
+    {1.0000000003, -2e-10, 1.6449340698990151425, -4.5486752374509762971e-9},
+    {0.9999, 0.0002, 1.644192404450438042, 0.0018813023897489823015},
+    {100000000.0, 30000000.0, 2.416703046979109139, 5.3570008530419534078e-8},
+    {-4000000000000.0, -1000000000000.0, -1.614926794150860979, -1.7675075169382178744e-12},
+    {0.05, 0.3, 0.029361843035737826307, 0.66858730204879097481},
+    {1.1, 0.1, 1.628361573701501701, 0.27255261048547518323},
+  };
+  //component-wise relative accuracy for |Im z|<=1e-3, normwise elsewhere
+  const double tol_strip=4e-15;
+  const double tol_norm=1e-14;
+}
+
+int main() {
+  using beaver_test::check_close;
+  for(const point& p : points){
+    const std::complex<double> z(p.x,p.y);
+    const std::complex<double> got=beaver::svdilog(z);
+    if(std::fabs(p.y)<=1e-3){
+      check_close("Re svdilog",z,got.real(),p.re,tol_strip);
+      check_close("Im svdilog",z,got.imag(),p.im,tol_strip);
+    }else{
+      const double norm=std::hypot(p.re,p.im);
+      check_close("Re svdilog",z,got.real(),p.re,tol_norm,norm);
+      check_close("Im svdilog",z,got.imag(),p.im,tol_norm,norm);
+    }
+    //svdilog(conj z)=conj svdilog(z)
+    beaver_test::check("svdilog conjugate",beaver::svdilog(std::conj(z))==std::conj(got));
+  }
+  //real axis: the real function and D=0; unit circle: Li2(e^{it}) with D=Cl2(t)
+  for(double x : {-50.0,-1.0,0.0,0.3,1.0,1.5,40.0}){
+    const std::complex<double> got=beaver::svdilog(std::complex<double>(x,0.0));
+    beaver_test::check_same("Re svdilog",x,got.real(),beaver::svdilog(x));
+    beaver_test::check_same("Im svdilog",x,got.imag(),0.0);
+  }
+  for(double t : {0.5,2.0,-1.0}){
+    const std::complex<double> z(std::cos(t),std::sin(t));
+    if(std::norm(z)!=1) continue;
+    const std::complex<double> got=beaver::svdilog(z);
+    check_close("Im svdilog",z,got.imag(),beaver::clausen2(std::atan2(z.imag(),z.real())),tol_strip);
+  }
+  const double nan=std::numeric_limits<double>::quiet_NaN();
+  beaver_test::check("svdilog(nan)",std::isnan(beaver::svdilog(std::complex<double>(nan,1.0)).imag()));
+
+  //array form: same results as the scalar calls
+  std::vector<std::complex<double>> z;
+  for(const point& p : points) z.emplace_back(p.x,p.y);
+  std::vector<std::complex<double>> out(z.size());
+  beaver::svdilog(z.data(),out.data(),z.size());
+  for(std::size_t i=0;i<z.size();++i){
+    beaver_test::check("svdilog array",out[i]==beaver::svdilog(z[i]));
+  }
+  return beaver_test::report("svdilog");
+}